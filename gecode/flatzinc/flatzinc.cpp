@@ -1015,10 +1015,36 @@ namespace Gecode { namespace FlatZinc {
     ConExprOrder ceo;
     std::sort(ces.begin(), ces.end(), ceo);
 
+    // Literals of all bool_clause constraints (see clauses)
+    std::vector<int> cl;
     for (unsigned int i=0; i<ces.size(); i++) {
       const ConExpr& ce = *ces[i];
       try {
-        registry().post(*this, ce);
+        if (ce.id == "bool_clause") {
+          bool sat = false;
+          size_t n = cl.size();
+          for (int j=0; j<2; j++) {
+            AST::Array* a = ce[j]->getArray();
+            for (unsigned int k=0; k<a->a.size(); k++)
+              if (a->a[k]->isBool()) {
+                // True literals satisfy the clause, false ones are dropped
+                if (a->a[k]->getBool() == (j == 0))
+                  sat = true;
+              } else {
+                int b = (a->a[k]->isIntVar() ?
+                         aliasBool2Int(a->a[k]->getIntVar()) : -1);
+                if (b == -1)
+                  b = a->a[k]->getBoolVar();
+                cl.push_back((j == 0) ? b+1 : -(b+1));
+              }
+          }
+          if (sat)
+            cl.resize(n);
+          else
+            cl.push_back(0);
+        } else {
+          registry().post(*this, ce);
+        }
       } catch (Gecode::Exception& e) {
           throw FlatZinc::Error("Gecode", e.what(), ce.ann);
       } catch (AST::TypeError& e) {
@@ -1027,6 +1053,8 @@ namespace Gecode { namespace FlatZinc {
       delete ces[i];
       ces[i] = nullptr;
     }
+    if (cl.size() > 0)
+      clauses(*this, bv, IntArgs(cl));
   }
 
   void flattenAnnotations(AST::Array* ann, std::vector<AST::Node*>& out) {
@@ -1410,6 +1410,24 @@ namespace Gecode {
   GECODE_INT_EXPORT void
   clause(Home home, BoolOpType o, const BoolVarArgs& x, const BoolVarArgs& y,
          int n, IntPropLevel ipl=IPL_DEF);
+  /** \brief Post domain consistent propagator for a set of Boolean clauses
+   *
+   * The clauses are given by the literals \a l in DIMACS style: a
+   * literal \f$i>0\f$ stands for \f$x_{i-1}\f$, a literal \f$i<0\f$ for
+   * \f$\neg x_{-i-1}\f$, and each clause is terminated by 0.
+   *
+   * All clauses are propagated by a single propagator using two watched
+   * literals per clause. The literals are shared between all clones of
+   * a space, which makes this preferable to posting many small clauses
+   * with clause or rel.
+   *
+   * Throws an exception of type Int::OutOfLimits, if a literal in \a l
+   * does not refer to a variable in \a x.
+   * \ingroup TaskModelIntRelBool
+   */
+  GECODE_INT_EXPORT void
+  clauses(Home home, const BoolVarArgs& x, const IntArgs& l,
+          IntPropLevel ipl=IPL_DEF);
   /** \brief Post propagator for if-then-else constraint
    *
    * Posts propagator for \f$ z = b ? x : y \f$
@@ -1738,7 +1756,10 @@ namespace Gecode {
   /** \brief Post propagator for \f$ x_i\neq x_j\f$ for all \f$0\leq i\neq j<|x|\f$
    *
    * Supports value (\a ipl = IPL_VAL, default), bounds (\a ipl = IPL_BND),
-   * and domain consistency (\a ipl = IPL_DOM).
+   * and domain consistency (\a ipl = IPL_DOM). For domain consistency,
+   * if \a ipl also includes IPL_ADVANCED, the matching is kept when
+   * the space is cloned and is used as a starting point for computing
+   * the matching of the clone.
    *
    * Throws an exception of type Int::ArgumentSame, if \a x contains
    * the same unassigned variable multiply.
@@ -1749,7 +1770,9 @@ namespace Gecode {
   /** \brief Post propagator for \f$ x_i+n_i\neq x_j+n_j\f$ for all \f$0\leq i\neq j<|x|\f$
    *
    * \li Supports value (\a ipl = IPL_VAL, default), bounds (\a ipl = IPL_BND),
-   *     and domain consistency (\a ipl = IPL_DOM).
+   *     and domain consistency (\a ipl = IPL_DOM). For domain consistency,
+   *     if \a ipl also includes IPL_ADVANCED, the matching is kept when
+   *     the space is cloned.
    * \li Throws an exception of type Int::OutOfLimits, if
    *     the integers in \a n exceed the limits in Int::Limits
    *     or if the sum of \a n and \a x exceed the limits.
@@ -2321,6 +2344,16 @@ namespace Gecode {
    * constraint. After a TupleSet is finalized, no more tuples may be
    * added to it.
    *
+   * Besides ordinary tuples, a tuple set can contain compressed
+   * tuples where each entry is an interval of values. A compressed
+   * tuple stands for all tuples in the Cartesian product of its
+   * intervals, without the product ever being expanded. An entry
+   * that accepts any value ("don't care") is expressed by the
+   * interval from Int::Limits::min to Int::Limits::max. Only the
+   * positive extensional constraint propagates compressed tuples
+   * directly, negative and reified extensional constraints expand
+   * them for the values of their variables when being posted.
+   *
    * \ingroup TaskModelIntExt
    */
   class TupleSet : public SharedHandle {
@@ -2341,6 +2374,8 @@ namespace Gecode {
       int max;
       /// Begin of supports
       BitSetData* s;
+      /// Offset between supports of consecutive values (zero if shared)
+      unsigned int step;
       /// Return the width
       unsigned int width(void) const;
       /// Return the supports for value \a n
@@ -2382,6 +2417,8 @@ namespace Gecode {
       std::size_t key;
       /// Tuple data
       int* td;
+      /// Upper bounds of tuple data (nullptr if no compressed tuples)
+      int* ud;
       /// Value data
       ValueData* vd;
       /// Pointer to all ranges
@@ -2403,6 +2440,8 @@ namespace Gecode {
       const Range* fst(int i) const;
       /// Return last range for position \a i
       const Range* lst(int i) const;
+      /// Compute ranges and supports for compressed tuples
+      void compress(void);
       /// Finalize datastructure (disallows additions of more Tuples)
       GECODE_INT_EXPORT
       void finalize(void);
@@ -2425,6 +2464,9 @@ namespace Gecode {
     /// Add tuple \a t to tuple set
     GECODE_INT_EXPORT
     void _add(const IntArgs& t);
+    /// Add compressed tuple with lower bounds \a l and upper bounds \a u
+    GECODE_INT_EXPORT
+    void _add(const IntArgs& l, const IntArgs& u);
     /// Test whether tuple set is equal to \a t
     GECODE_INT_EXPORT
     bool equal(const TupleSet& t) const;
@@ -2460,6 +2502,13 @@ namespace Gecode {
     //@{
     /// Add tuple \a t to tuple set
     TupleSet& add(const IntArgs& t);
+    /** \brief Add compressed tuple to tuple set
+     *
+     * The tuple accepts all values between \a l[i] and \a u[i] for
+     * position \a i. If \a l[i] > \a u[i] for some position, the
+     * tuple is empty and is ignored.
+     */
+    TupleSet& add(const IntArgs& l, const IntArgs& u);
     /// Is tuple set finalized
     bool finalized(void) const;
     /// Finalize tuple set
@@ -2474,8 +2523,12 @@ namespace Gecode {
     int tuples(void) const;
     /// Return number of required bit set words
     unsigned int words(void) const;
-    /// Get tuple \a i
+    /// Get tuple \a i (lower bounds for compressed tuples)
     Tuple operator [](int i) const;
+    /// Get upper bounds of tuple \a i (same as tuple \a i if not compressed)
+    Tuple upper(int i) const;
+    /// Whether tuple set contains compressed tuples
+    bool compressed(void) const;
     /// Return minimal value in all tuples
     int min(void) const;
     /// Return maximal value in all tuples
@@ -2529,6 +2582,151 @@ namespace Gecode {
 
 #include <gecode/int/extensional/tuple-set.hpp>
 
+namespace Gecode {
+
+  /**
+   * \brief Multi-valued decision diagram (%MDD)
+   *
+   * An %MDD of arity \f$n\f$ has \f$n+1\f$ layers of nodes. An edge
+   * leads from a node on layer \f$l\f$ to a node on layer \f$l+1\f$
+   * and is labelled by a value for position \f$l\f$. A tuple belongs
+   * to the %MDD if its values label a path from the root (node zero on
+   * layer zero) to the terminal (node zero on layer \f$n\f$). In
+   * contrast to a %DFA, each layer has its own nodes and its own set
+   * of values.
+   *
+   * An %MDD is always reduced: nodes that are not on a path from the
+   * root to the terminal are removed and nodes on the same layer with
+   * the same outgoing edges are merged. The diagram is shared among
+   * all copies of an %MDD and all propagators using it.
+   *
+   * \ingroup TaskModelIntExt
+   */
+  class MDD : public SharedHandle {
+  public:
+    /// Specification of an %MDD edge
+    class Edge {
+    public:
+      int i_node; ///< Node on the layer the edge leaves
+      int val;    ///< Value
+      int o_node; ///< Node on the next layer
+      /// Default constructor
+      Edge(void);
+      /// Initialize members
+      Edge(int i_node0, int val0, int o_node0);
+    };
+  private:
+    /// Implementation of MDD
+    class MDDI;
+    /**
+     * \brief Initialize by reducing a layered graph
+     *
+     * The layered graph has arity \a a, layer \f$l\f$ has \a w[l]
+     * nodes and the \a n[l] edges \a e[l] leading to layer
+     * \f$l+1\f$. Layer \a a must have a single node. The edges of
+     * each node must have different values. The arrays \a w, \a e,
+     * and \a n are overwritten.
+     */
+    void init(int a, int w[], Edge* e[], int n[]);
+  public:
+    /// Iterator for edges of a layer (sorted by values)
+    class Edges {
+    private:
+      /// Current edge
+      const Edge* c_edge;
+      /// End of edges
+      const Edge* e_edge;
+    public:
+      /// Initialize to all edges of layer \a l of %MDD \a m
+      Edges(const MDD& m, int l);
+      /// Initialize to edges of layer \a l of %MDD \a m for value \a v
+      Edges(const MDD& m, int l, int v);
+      /// Test whether iterator still at an edge
+      bool operator ()(void) const;
+      /// Move iterator to next edge
+      void operator ++(void);
+      /// Return node the current edge leaves
+      int i_node(void) const;
+      /// Return value of current edge
+      int val(void) const;
+      /// Return node the current edge leads to
+      int o_node(void) const;
+    };
+    /// Iterator for values of a layer
+    class Values {
+    private:
+      /// Current edge
+      const Edge* c_edge;
+      /// End of edges
+      const Edge* e_edge;
+    public:
+      /// Initialize to values of layer \a l of %MDD \a m
+      Values(const MDD& m, int l);
+      /// Test whether iterator still at a value
+      bool operator ()(void) const;
+      /// Move iterator to next value
+      void operator ++(void);
+      /// Return current value
+      int val(void) const;
+    };
+    friend class Edges;
+    friend class Values;
+    /// Initialize as %MDD of arity zero that contains the empty tuple
+    MDD(void);
+    /**
+     * \brief Initialize with the tuples of tuple set \a ts
+     *
+     * Throws an exception of type Int::NotYetFinalized, if the tuple
+     * set \a ts has not been finalized, and of type
+     * Int::IllegalOperation, if \a ts contains compressed tuples.
+     */
+    GECODE_INT_EXPORT
+    explicit MDD(const TupleSet& ts);
+    /**
+     * \brief Initialize with the words of length \a n accepted by \a d
+     *
+     * Throws an exception of type Int::OutOfLimits, if \a n is negative.
+     */
+    GECODE_INT_EXPORT
+    MDD(int n, const DFA& d);
+    /// Initialize by %MDD \a m (%MDD is shared)
+    MDD(const MDD& m);
+    /// Test whether %MDD is equal to \a m
+    GECODE_INT_EXPORT
+    bool operator ==(const MDD& m) const;
+    /// Test whether %MDD is not equal to \a m
+    bool operator !=(const MDD& m) const;
+    /// Return the arity
+    int arity(void) const;
+    /// Test whether the %MDD does not contain any tuple
+    bool empty(void) const;
+    /// Return the number of nodes on layer \a l
+    int width(int l) const;
+    /// Return the maximal number of nodes on any layer
+    int max_width(void) const;
+    /// Return the total number of nodes
+    int n_nodes(void) const;
+    /// Return the total number of edges
+    int n_edges(void) const;
+    /**
+     * \brief Return maximal degree
+     *
+     * This is the maximum of the in-degree and out-degree of any node
+     * and the number of edges for any value on any layer.
+     */
+    unsigned int max_degree(void) const;
+    /// Return smallest value in %MDD
+    int min(void) const;
+    /// Return largest value in %MDD
+    int max(void) const;
+    /// Return hash key
+    std::size_t hash(void) const;
+  };
+
+}
+
+#include <gecode/int/extensional/mdd.hpp>
+
 namespace Gecode {
 
   /**
@@ -2563,6 +2761,42 @@ namespace Gecode {
   extensional(Home home, const BoolVarArgs& x, DFA d,
               IntPropLevel ipl=IPL_DEF);
 
+  /**
+   * \brief Post domain consistent propagator for extensional constraint described by an %MDD
+   *
+   * The elements of \a x must label a path from the root to the
+   * terminal of the %MDD \a m.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a x
+   * and \a m have different arity. Throws an exception of type
+   * Int::ArgumentSame, if \a x contains the same unassigned variable
+   * multiply. If shared occurrences of variables are required, unshare
+   * should be used.
+   *
+   * \ingroup TaskModelIntExt
+   */
+  GECODE_INT_EXPORT void
+  extensional(Home home, const IntVarArgs& x, const MDD& m,
+              IntPropLevel ipl=IPL_DEF);
+
+  /**
+   * \brief Post domain consistent propagator for extensional constraint described by an %MDD
+   *
+   * The elements of \a x must label a path from the root to the
+   * terminal of the %MDD \a m.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a x
+   * and \a m have different arity. Throws an exception of type
+   * Int::ArgumentSame, if \a x contains the same unassigned variable
+   * multiply. If shared occurrences of variables are required, unshare
+   * should be used.
+   *
+   * \ingroup TaskModelIntExt
+   */
+  GECODE_INT_EXPORT void
+  extensional(Home home, const BoolVarArgs& x, const MDD& m,
+              IntPropLevel ipl=IPL_DEF);
+
   /** \brief Post propagator for \f$x\in t\f$.
    *
    * \li Supports domain consistency (\a ipl = IPL_DOM, default) only.
@@ -2948,6 +3182,12 @@ namespace Gecode {
    *    type Int::OutOfLimits is thrown.
    *  - In all other cases, the created propagators are accurate (that
    *    is, they will not silently overflow during propagation).
+   *  - If \a ipl includes IPL_ADVANCED, bounds consistent non-reified
+   *    equations and inequalities with more than three variables
+   *    maintain the bounds of the sum incrementally and only prune
+   *    when a variable's domain is wider than the slack. This pays off
+   *    for constraints with many variables, in particular if search
+   *    uses recomputation, but requires more memory per constraint.
    */
   /** \brief Post propagator for \f$\sum_{i=0}^{|x|-1}x_i\sim_{irt} c\f$
    * \ingroup TaskModelIntLI
@@ -3648,6 +3888,11 @@ namespace Gecode {
    *    and edge finding.
    *  - If both flags are combined, all the above listed propagation is
    *    performed.
+   *  - If \a IPL_BND is set, the propagator additionally performs
+   *    time-table edge-finding.
+   *  - If \a IPL_DOM is set, the propagator additionally performs
+   *    time-table edge-finding and energetic reasoning (which takes
+   *    cubic time in the number of tasks).
    *
    * The propagator uses algorithms taken from:
    *
@@ -3661,6 +3906,12 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS,
    * pages 802-816. Springer, 2009.
    *
+   * Time-table edge-finding follows:
+   *
+   * Petr Vilím, Timetable edge finding filtering algorithm for discrete
+   * cumulative resources. In T. Achterberg and J. C. Beck, editors, CPAIOR,
+   * volume 6697 of LNCS, pages 230-245. Springer, 2011.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a t, \a s
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a p, \a u, or \a c
@@ -3707,6 +3958,11 @@ namespace Gecode {
    *    and edge finding.
    *  - If both flags are combined, all the above listed propagation is
    *    performed.
+   *  - If \a IPL_BND is set, the propagator additionally performs
+   *    time-table edge-finding.
+   *  - If \a IPL_DOM is set, the propagator additionally performs
+   *    time-table edge-finding and energetic reasoning (which takes
+   *    cubic time in the number of tasks).
    *
    * The propagator uses algorithms taken from:
    *
@@ -3720,6 +3976,12 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS,
    * pages 802-816. Springer, 2009.
    *
+   * Time-table edge-finding follows:
+   *
+   * Petr Vilím, Timetable edge finding filtering algorithm for discrete
+   * cumulative resources. In T. Achterberg and J. C. Beck, editors, CPAIOR,
+   * volume 6697 of LNCS, pages 230-245. Springer, 2011.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a t, \a s
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a p, \a u, or \a c
@@ -3752,6 +4014,11 @@ namespace Gecode {
    *    and edge finding.
    *  - If both flags are combined, all the above listed propagation is
    *    performed.
+   *  - If \a IPL_BND is set, the propagator additionally performs
+   *    time-table edge-finding.
+   *  - If \a IPL_DOM is set, the propagator additionally performs
+   *    time-table edge-finding and energetic reasoning (which takes
+   *    cubic time in the number of tasks).
    *
    * The propagator uses algorithms taken from:
    *
@@ -3765,6 +4032,12 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS,
    * pages 802-816. Springer, 2009.
    *
+   * Time-table edge-finding follows:
+   *
+   * Petr Vilím, Timetable edge finding filtering algorithm for discrete
+   * cumulative resources. In T. Achterberg and J. C. Beck, editors, CPAIOR,
+   * volume 6697 of LNCS, pages 230-245. Springer, 2011.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a p, \a u, or \a c
@@ -3797,6 +4070,11 @@ namespace Gecode {
    *    and edge finding.
    *  - If both flags are combined, all the above listed propagation is
    *    performed.
+   *  - If \a IPL_BND is set, the propagator additionally performs
+   *    time-table edge-finding.
+   *  - If \a IPL_DOM is set, the propagator additionally performs
+   *    time-table edge-finding and energetic reasoning (which takes
+   *    cubic time in the number of tasks).
    *
    * The propagator uses algorithms taken from:
    *
@@ -3810,6 +4088,12 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS,
    * pages 802-816. Springer, 2009.
    *
+   * Time-table edge-finding follows:
+   *
+   * Petr Vilím, Timetable edge finding filtering algorithm for discrete
+   * cumulative resources. In T. Achterberg and J. C. Beck, editors, CPAIOR,
+   * volume 6697 of LNCS, pages 230-245. Springer, 2011.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s,
    *    \a p, \a u, or \a m are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a p, \a u, or \a c
@@ -3844,6 +4128,11 @@ namespace Gecode {
    *    and edge finding.
    *  - If both flags are combined, all the above listed propagation is
    *    performed.
+   *  - If \a IPL_BND is set, the propagator additionally performs
+   *    time-table edge-finding.
+   *  - If \a IPL_DOM is set, the propagator additionally performs
+   *    time-table edge-finding and energetic reasoning (which takes
+   *    cubic time in the number of tasks).
    *
    * The propagator uses algorithms taken from:
    *
@@ -3857,6 +4146,12 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS,
    * pages 802-816. Springer, 2009.
    *
+   * Time-table edge-finding follows:
+   *
+   * Petr Vilím, Timetable edge finding filtering algorithm for discrete
+   * cumulative resources. In T. Achterberg and J. C. Beck, editors, CPAIOR,
+   * volume 6697 of LNCS, pages 230-245. Springer, 2011.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a u or \a c
@@ -3893,6 +4188,11 @@ namespace Gecode {
    *    and edge finding.
    *  - If both flags are combined, all the above listed propagation is
    *    performed.
+   *  - If \a IPL_BND is set, the propagator additionally performs
+   *    time-table edge-finding.
+   *  - If \a IPL_DOM is set, the propagator additionally performs
+   *    time-table edge-finding and energetic reasoning (which takes
+   *    cubic time in the number of tasks).
    *
    * The propagator uses algorithms taken from:
    *
@@ -3906,6 +4206,12 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS,
    * pages 802-816. Springer, 2009.
    *
+   * Time-table edge-finding follows:
+   *
+   * Petr Vilím, Timetable edge finding filtering algorithm for discrete
+   * cumulative resources. In T. Achterberg and J. C. Beck, editors, CPAIOR,
+   * volume 6697 of LNCS, pages 230-245. Springer, 2011.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s,
    *    \a p, \a u, or \a m are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a u or \a c
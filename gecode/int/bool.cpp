@@ -987,6 +987,88 @@ namespace Gecode {
     }
   }
 
+  void
+  clauses(Home home, const BoolVarArgs& x, const IntArgs& l,
+          IntPropLevel) {
+    using namespace Int;
+    for (int k=0; k<l.size(); k++)
+      if ((l[k] < -x.size()) || (l[k] > x.size()))
+        throw OutOfLimits("Int::clauses");
+    GECODE_POST;
+    Region r;
+    int n = x.size();
+    // Literals (as 2i for x[i] and 2i+1 for !x[i]) of all clauses
+    int* lit = r.alloc<int>(l.size());
+    // Start of each clause in lit
+    int* cs = r.alloc<int>(l.size()+1);
+    // Last clause in which a literal occurs
+    int* occ = r.alloc<int>(2*n);
+    for (int i=2*n; i--; )
+      occ[i] = -1;
+    // Literals of unit clauses
+    int* u = r.alloc<int>(l.size());
+    int n_lit = 0, n_cs = 0, n_u = 0;
+    for (int k=0, c=0; k<l.size(); k++, c++) {
+      int s = n_lit;
+      bool sat = false;
+      for ( ; (k<l.size()) && (l[k] != 0); k++)
+        if (!sat) {
+          int i = std::abs(l[k])-1;
+          int e = 2*i + ((l[k] < 0) ? 1 : 0);
+          BoolView xi(x[i]);
+          if (xi.assigned()) {
+            // True literals satisfy the clause, false ones are dropped
+            sat = (xi.val() != (e & 1));
+          } else if (occ[e^1] == c) {
+            // Tautology
+            sat = true;
+          } else if (occ[e] != c) {
+            occ[e] = c; lit[n_lit++] = e;
+          }
+        }
+      if (sat) {
+        n_lit = s;
+      } else if (n_lit == s) {
+        home.fail(); return;
+      } else if (n_lit == s+1) {
+        u[n_u++] = lit[--n_lit];
+      } else {
+        cs[n_cs++] = s;
+      }
+    }
+    cs[n_cs] = n_lit;
+    if (n_cs > 0) {
+      // Only keep variables that occur in the clauses
+      int* m = r.alloc<int>(n);
+      for (int i=n; i--; )
+        m[i] = -1;
+      int n_x = 0;
+      IntSharedArray sl(n_lit);
+      for (int j=0; j<n_lit; j++) {
+        int i = lit[j] >> 1;
+        if (m[i] < 0)
+          m[i] = n_x++;
+        sl[j] = 2*m[i] + (lit[j] & 1);
+      }
+      ViewArray<BoolView> xv(home,n_x);
+      for (int i=n; i--; )
+        if (m[i] >= 0)
+          xv[m[i]] = x[i];
+      IntSharedArray scs(n_cs+1);
+      for (int j=0; j<=n_cs; j++)
+        scs[j] = cs[j];
+      GECODE_ES_FAIL(Bool::ClauseDB::post(home,xv,sl,scs));
+    }
+    for (int j=0; j<n_u; j++) {
+      BoolView xi(x[u[j] >> 1]);
+      if ((u[j] & 1) == 0) {
+        GECODE_ME_FAIL(xi.one(home));
+      } else {
+        GECODE_ME_FAIL(xi.zero(home));
+      }
+    }
+  }
+
   void
   ite(Home home, BoolVar b, IntVar x, IntVar y, IntVar z,
       IntPropLevel ipl) {
@@ -570,6 +570,94 @@ namespace Gecode { namespace Int { namespace Bool {
   };
 
 
+  /**
+   * \brief Propagator for a database of Boolean clauses
+   *
+   * A literal \f$2i\f$ stands for \f$x_i\f$ and a literal \f$2i+1\f$
+   * for \f$\neg x_i\f$. The literals of all clauses are stored in a
+   * shared array that is not copied during cloning. Each clause watches
+   * two of its literals, the watches for a literal are kept as a linked
+   * list in flat arrays. Only these arrays are copied during cloning.
+   *
+   * Requires \code #include <gecode/int/bool.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  class ClauseDB : public Propagator {
+  protected:
+    /// %Advisor for a variable
+    class Idx : public Advisor {
+    public:
+      /// Index of the variable
+      const int i;
+      /// Create advisor for variable \a i
+      Idx(Space& home, Propagator& p, Council<Idx>& c, int i);
+      /// Clone advisor \a a
+      Idx(Space& home, Idx& a);
+    };
+    /// The variables
+    ViewArray<BoolView> x;
+    /// The literals of all clauses
+    IntSharedArray lit;
+    /// The start of each clause in \a lit (plus the end of the last)
+    IntSharedArray cs;
+    /// Position in \a lit of the literal watched by a watch (two per clause)
+    int* w;
+    /// Next watch for the same literal (or -1)
+    int* nx;
+    /// First watch for each literal (or -1)
+    int* hd;
+    /// Variables that have been assigned but not yet processed
+    int* pv;
+    /// Number of variables that have been assigned but not yet processed
+    int np;
+    /// Number of not yet assigned variables
+    int na;
+    /// The advisor council
+    Council<Idx> c;
+    /// Test whether literal \a l is true
+    bool one(int l) const;
+    /// Test whether literal \a l is false
+    bool zero(int l) const;
+    /// Make literal \a l true
+    ModEvent one(Space& home, int l);
+    /// Constructor for posting
+    ClauseDB(Home home, ViewArray<BoolView>& x,
+             IntSharedArray& lit, IntSharedArray& cs);
+    /// Constructor for cloning \a p
+    ClauseDB(Space& home, ClauseDB& p);
+  public:
+    /// Copy propagator during cloning
+    GECODE_INT_EXPORT
+    virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    GECODE_INT_EXPORT
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Cost function (defined as low linear in the number of pending variables)
+    GECODE_INT_EXPORT
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    GECODE_INT_EXPORT
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    GECODE_INT_EXPORT
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /**
+     * \brief Post propagator for clauses
+     *
+     * The literals of clause \f$j\f$ are \f$l_{s_j},\ldots,l_{s_{j+1}-1}\f$
+     * where \f$s\f$ is \a cs and \f$l\f$ is \a lit. All literals must
+     * refer to variables in \a x that are not assigned, each clause must
+     * have at least two different literals.
+     */
+    GECODE_INT_EXPORT
+    static ExecStatus post(Home home, ViewArray<BoolView>& x,
+                           IntSharedArray& lit, IntSharedArray& cs);
+    /// Delete propagator and return its size
+    GECODE_INT_EXPORT
+    virtual size_t dispose(Space& home);
+  };
+
+
   /**
    * \brief If-then-else propagator base-class
    *
@@ -658,6 +746,7 @@ namespace Gecode { namespace Int { namespace Bool {
 #include <gecode/int/bool/or.hpp>
 #include <gecode/int/bool/eqv.hpp>
 #include <gecode/int/bool/clause.hpp>
+#include <gecode/int/bool/clause-db.hpp>
 #include <gecode/int/bool/ite.hpp>
 
 #endif
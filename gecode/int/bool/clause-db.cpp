@@ -0,0 +1,136 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2020
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/int/bool.hh>
+
+namespace Gecode { namespace Int { namespace Bool {
+
+  /*
+   * Propagator for a database of clauses
+   *
+   */
+
+  Actor*
+  ClauseDB::copy(Space& home) {
+    return new (home) ClauseDB(home,*this);
+  }
+
+  ExecStatus
+  ClauseDB::post(Home home, ViewArray<BoolView>& x,
+                 IntSharedArray& lit, IntSharedArray& cs) {
+    if (cs.size() > 1)
+      (void) new (home) ClauseDB(home,x,lit,cs);
+    return ES_OK;
+  }
+
+  size_t
+  ClauseDB::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    for (Advisors<Idx> as(c); as(); ++as) {
+      x[as.advisor().i].cancel(home,as.advisor());
+      as.advisor().dispose(home,c);
+    }
+    c.dispose(home);
+    int n = cs.size()-1;
+    home.free<int>(w,2*n);
+    home.free<int>(nx,2*n);
+    home.free<int>(hd,2*x.size());
+    home.free<int>(pv,x.size());
+    lit.~IntSharedArray();
+    cs.~IntSharedArray();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  PropCost
+  ClauseDB::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::LO,np);
+  }
+
+  void
+  ClauseDB::reschedule(Space& home) {
+    if ((np > 0) || (na == 0))
+      BoolView::schedule(home,*this,ME_BOOL_VAL);
+  }
+
+  ExecStatus
+  ClauseDB::advise(Space& home, Advisor& _a, const Delta&) {
+    Idx& a = static_cast<Idx&>(_a);
+    na--;
+    // Only the negated literal of the variable's value can become false
+    if (hd[2*a.i + x[a.i].val()] >= 0) {
+      pv[np++] = a.i;
+    } else if (na > 0) {
+      return home.ES_FIX_DISPOSE(c,a);
+    }
+    return home.ES_NOFIX_DISPOSE(c,a);
+  }
+
+  ExecStatus
+  ClauseDB::propagate(Space& home, const ModEventDelta&) {
+    // Assigning a literal during propagation adds to the pending variables
+    while (np > 0) {
+      int i = pv[--np];
+      // The literal that has become false
+      int f = 2*i + x[i].val();
+      int* p = &hd[f];
+      while (*p >= 0) {
+        int k = *p;
+        // The other literal watched by the same clause
+        int o = lit[w[k^1]];
+        if (one(o)) {
+          p = &nx[k]; continue;
+        }
+        // Find a new literal to watch
+        int j = cs[k >> 1], e = cs[(k >> 1) + 1];
+        while ((j < e) && ((j == w[k^1]) || zero(lit[j])))
+          j++;
+        if (j < e) {
+          // Move the watch to the list of the new literal
+          *p = nx[k];
+          w[k] = j;
+          nx[k] = hd[lit[j]]; hd[lit[j]] = k;
+        } else {
+          // The clause is unit (or failed)
+          GECODE_ME_CHECK(one(home,o));
+          p = &nx[k];
+        }
+      }
+    }
+    return (na == 0) ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -0,0 +1,106 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2020
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode { namespace Int { namespace Bool {
+
+  /*
+   * Propagator for a database of clauses
+   *
+   */
+
+  forceinline
+  ClauseDB::Idx::Idx(Space& home, Propagator& p, Council<Idx>& c, int i0)
+    : Advisor(home,p,c), i(i0) {}
+
+  forceinline
+  ClauseDB::Idx::Idx(Space& home, Idx& a)
+    : Advisor(home,a), i(a.i) {}
+
+  forceinline bool
+  ClauseDB::one(int l) const {
+    return x[l >> 1].assigned() && (x[l >> 1].val() != (l & 1));
+  }
+
+  forceinline bool
+  ClauseDB::zero(int l) const {
+    return x[l >> 1].assigned() && (x[l >> 1].val() == (l & 1));
+  }
+
+  forceinline ModEvent
+  ClauseDB::one(Space& home, int l) {
+    return ((l & 1) == 0) ? x[l >> 1].one(home) : x[l >> 1].zero(home);
+  }
+
+  forceinline
+  ClauseDB::ClauseDB(Home home, ViewArray<BoolView>& x0,
+                     IntSharedArray& lit0, IntSharedArray& cs0)
+    : Propagator(home), x(x0), lit(lit0), cs(cs0),
+      np(0), na(x0.size()), c(home) {
+    home.notice(*this,AP_DISPOSE);
+    int n = cs.size()-1;
+    w  = static_cast<Space&>(home).alloc<int>(2*n);
+    nx = static_cast<Space&>(home).alloc<int>(2*n);
+    hd = static_cast<Space&>(home).alloc<int>(2*x.size());
+    pv = static_cast<Space&>(home).alloc<int>(x.size());
+    for (int l=2*x.size(); l--; )
+      hd[l] = -1;
+    // Watch the first two literals of each clause
+    for (int j=0; j<2*n; j++) {
+      w[j] = cs[j >> 1] + (j & 1);
+      int l = lit[w[j]];
+      nx[j] = hd[l]; hd[l] = j;
+    }
+    for (int i=0; i<x.size(); i++)
+      x[i].subscribe(home,*new (home) Idx(home,*this,c,i));
+  }
+
+  forceinline
+  ClauseDB::ClauseDB(Space& home, ClauseDB& p)
+    : Propagator(home,p), lit(p.lit), cs(p.cs), np(0), na(p.na) {
+    assert(p.np == 0);
+    x.update(home,p.x);
+    c.update(home,p.c);
+    int n = cs.size()-1;
+    w  = home.alloc<int>(2*n);
+    nx = home.alloc<int>(2*n);
+    hd = home.alloc<int>(2*x.size());
+    pv = home.alloc<int>(x.size());
+    Heap::copy<int>(w,p.w,2*n);
+    Heap::copy<int>(nx,p.nx,2*n);
+    Heap::copy<int>(hd,p.hd,2*x.size());
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -672,6 +672,61 @@ namespace Gecode { namespace Int { namespace Cumulative {
 
 #include <gecode/int/cumulative/tree.hpp>
 
+namespace Gecode { namespace Int { namespace Cumulative {
+
+  /**
+   * \brief Persistent order of events for time-tabling
+   *
+   * Time-tabling processes the events of all tasks ordered by time.
+   * As only few task bounds change between two executions of a
+   * propagator, the order computed by the last execution is kept and
+   * repaired by insertion sort: the cost is linear in the number of
+   * events plus the number of events that moved past each other (that
+   * is, it only depends on the time windows affected by the changes).
+   * If too many events move, all events are sorted from scratch.
+   *
+   * Each task owns four events (identified by the key four times the
+   * task index plus the event kind) whose validity and type depend on
+   * the current state of the task.
+   */
+  class EventOrder {
+  protected:
+    /// Kind of events per task
+    enum EventKind {
+      EK_START  = 0, ///< Earliest start time
+      EK_END    = 1, ///< Latest completion time
+      EK_RSTART = 2, ///< Start of required part or zero-length task
+      EK_REND   = 3  ///< End of required part
+    };
+    /// Number of moves per event after which sorting starts from scratch
+    static const int budget = 8;
+    /// Event keys in the order of the last execution
+    int* o;
+    /// Number of event keys
+    int n;
+  public:
+    /// Initialize as empty
+    EventOrder(void);
+    /// Update during cloning
+    void update(Space& home, const EventOrder& eo);
+    /// Release memory
+    void dispose(Space& home);
+    /**
+     * \brief Allocate from \a r and initialize event array with tasks \a t
+     *
+     * Returns nullptr if no task has a required part. The flag \a reset
+     * must be true if the order of the tasks in \a t has changed since
+     * the last call.
+     */
+    template<class Task>
+    Event* events(Space& home, Region& r, const TaskArray<Task>& t,
+                  bool& assigned, bool reset);
+  };
+
+}}}
+
+#include <gecode/int/cumulative/event-order.hpp>
+
 namespace Gecode { namespace Int { namespace Cumulative {
 
   /// Check for subsumption (all tasks must be assigned)
@@ -683,15 +738,33 @@ namespace Gecode { namespace Int { namespace Cumulative {
   template<class ManTask>
   ExecStatus overload(Space& home, int c, TaskArray<ManTask>& t);
 
-  /// Perform time-tabling propagation
+  /// Perform time-tabling propagation with persistent event order \a eo
   template<class Task, class Cap>
   ExecStatus timetabling(Space& home, Propagator& p, Cap c,
-                         TaskArray<Task>& t);
+                         TaskArray<Task>& t, EventOrder& eo);
 
   /// Propagate by edge-finding
   template<class Task>
   ExecStatus edgefinding(Space& home, int c, TaskArray<Task>& t);
 
+  /// Propagate by time-table edge-finding
+  template<class Task>
+  ExecStatus ttef(Space& home, int c, TaskArray<Task>& t);
+
+  /// Propagate by energetic reasoning
+  template<class Task>
+  ExecStatus energetic(Space& home, int c, TaskArray<Task>& t);
+
+  /// Additional (opt-in) propagation for cumulative resources
+  enum ExtProp {
+    EP_NONE      = 0, ///< No additional propagation
+    EP_TTEF      = 1, ///< Time-table edge-finding
+    EP_ENERGETIC = 2  ///< Energetic reasoning
+  };
+
+  /// Extract additional propagation (see ExtProp) from propagation level \a ipl
+  int extprop(IntPropLevel ipl);
+
   /**
    * \brief Scheduling propagator for cumulative resource with mandatory tasks
    *
@@ -704,8 +777,12 @@ namespace Gecode { namespace Int { namespace Cumulative {
     using TaskProp<ManTask,PL>::t;
     /// Resource capacity
     Cap c;
+    /// Order of events for time-tabling
+    EventOrder eo;
+    /// Additional propagation (see ExtProp)
+    int ep;
     /// Constructor for creation
-    ManProp(Home home, Cap c, TaskArray<ManTask>& t);
+    ManProp(Home home, Cap c, TaskArray<ManTask>& t, int ep);
     /// Constructor for cloning \a p
     ManProp(Space& home, ManProp& p);
   public:
@@ -714,7 +791,8 @@ namespace Gecode { namespace Int { namespace Cumulative {
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
     /// Post propagator that schedules tasks on cumulative resource
-    static ExecStatus post(Home home, Cap c, TaskArray<ManTask>& t);
+    static ExecStatus post(Home home, Cap c, TaskArray<ManTask>& t,
+                           int ep=EP_NONE);
     /// Delete propagator and return its size
     virtual size_t dispose(Space& home);
   };
@@ -731,8 +809,12 @@ namespace Gecode { namespace Int { namespace Cumulative {
     using TaskProp<OptTask,PL>::t;
     /// Resource capacity
     Cap c;
+    /// Order of events for time-tabling
+    EventOrder eo;
+    /// Additional propagation (see ExtProp)
+    int ep;
     /// Constructor for creation
-    OptProp(Home home, Cap c, TaskArray<OptTask>& t);
+    OptProp(Home home, Cap c, TaskArray<OptTask>& t, int ep);
     /// Constructor for cloning \a p
     OptProp(Space& home, OptProp& p);
   public:
@@ -741,7 +823,8 @@ namespace Gecode { namespace Int { namespace Cumulative {
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
     /// Post propagator that schedules tasks on cumulative resource
-    static ExecStatus post(Home home, Cap c, TaskArray<OptTask>& t);
+    static ExecStatus post(Home home, Cap c, TaskArray<OptTask>& t,
+                           int ep=EP_NONE);
     /// Delete propagator and return its size
     virtual size_t dispose(Space& home);
   };
@@ -762,6 +845,8 @@ namespace Gecode { namespace Int { namespace Cumulative {
 #include <gecode/int/cumulative/subsumption.hpp>
 #include <gecode/int/cumulative/overload.hpp>
 #include <gecode/int/cumulative/edge-finding.hpp>
+#include <gecode/int/cumulative/ttef.hpp>
+#include <gecode/int/cumulative/energetic.hpp>
 #include <gecode/int/cumulative/man-prop.hpp>
 #include <gecode/int/cumulative/opt-prop.hpp>
 #include <gecode/int/cumulative/post.hpp>
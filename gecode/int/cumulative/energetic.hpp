@@ -0,0 +1,123 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <algorithm>
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Cumulative {
+
+  /// Minimal energy of task \a t in [\a a, \a b) (the minimal intersection)
+  forceinline long long int
+  minenergy(const TaskEnergy& t, int a, int b) {
+    long long int o =
+      std::min(std::min(static_cast<long long int>(b) - a,
+                        static_cast<long long int>(t.p)),
+               std::min(static_cast<long long int>(t.ect) - a,
+                        static_cast<long long int>(b) - t.lst));
+    return (o > 0) ? t.c * o : 0;
+  }
+
+  /// Sort and remove duplicates from the \a n integers \a x, return new size
+  forceinline int
+  unique(int* x, int n) {
+    Support::quicksort(x, n);
+    return static_cast<int>(std::unique(x, x+n) - x);
+  }
+
+  template<class TaskView>
+  ExecStatus
+  energetic(Space& home, int c, TaskViewArray<TaskView>& t) {
+    int n = t.size();
+    Region r;
+
+    TaskEnergy* s = r.alloc<TaskEnergy>(n);
+    // Maximal energy a single task can require when left-shifted
+    long long int emax = 0;
+    // Candidates for start (t1) and end (t2) of intervals
+    int* t1 = r.alloc<int>(3*n);
+    int* t2 = r.alloc<int>(3*n);
+    for (int i=0; i<n; i++) {
+      s[i].init(t[i]);
+      emax = std::max(emax, s[i].c * overlap(s[i].est,s[i].ect,
+                                             s[i].est,s[i].lct));
+      t1[3*i+0] = s[i].est; t1[3*i+1] = s[i].lst; t1[3*i+2] = s[i].ect;
+      t2[3*i+0] = s[i].lct; t2[3*i+1] = s[i].ect; t2[3*i+2] = s[i].lst;
+    }
+    int n1 = unique(t1, 3*n);
+    int n2 = unique(t2, 3*n);
+
+    for (int i1=0; i1<n1; i1++) {
+      int a = t1[i1];
+      for (int i2=static_cast<int>(std::upper_bound(t2,t2+n2,a) - t2);
+           i2<n2; i2++) {
+        int b = t2[i2];
+        // Energy that must be spent in [a,b)
+        long long int e = 0;
+        for (int i=0; i<n; i++)
+          e += minenergy(s[i],a,b);
+        long long int slack =
+          static_cast<long long int>(c) * (static_cast<long long int>(b) - a)
+          - e;
+        if (slack < 0)
+          return ES_FAILED;
+        if (slack >= emax)
+          continue;
+        for (int u=0; u<n; u++)
+          if (s[u].c * overlap(s[u].est,s[u].ect,a,b) > slack) {
+            // Energy available to u
+            long long int w = slack + minenergy(s[u],a,b);
+            if (s[u].c * overlap(s[u].est,s[u].ect,a,b) > w) {
+              long long int nest = a;
+              if (s[u].p > w / s[u].c)
+                nest = std::max(nest, b - w / s[u].c);
+              GECODE_ME_CHECK(t[u].est(home,static_cast<int>(nest)));
+            }
+          }
+      }
+    }
+    return ES_OK;
+  }
+
+  template<class Task>
+  ExecStatus
+  energetic(Space& home, int c, TaskArray<Task>& t) {
+    TaskViewArray<typename TaskTraits<Task>::TaskViewFwd> f(t);
+    GECODE_ES_CHECK(energetic(home,c,f));
+    TaskViewArray<typename TaskTraits<Task>::TaskViewBwd> b(t);
+    GECODE_ES_CHECK(energetic(home,c,b));
+    return ES_OK;
+  }
+
+}}}
+
+// STATISTICS: int-prop
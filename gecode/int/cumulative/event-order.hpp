@@ -0,0 +1,165 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int { namespace Cumulative {
+
+  /// Sort order for events given by their key
+  class EventByKey {
+  protected:
+    /// The events indexed by key
+    const Event* e;
+  public:
+    /// Initialize with events \a e0
+    EventByKey(const Event* e0);
+    /// Sort order
+    bool operator ()(const int& i, const int& j) const;
+  };
+
+  forceinline
+  EventByKey::EventByKey(const Event* e0) : e(e0) {}
+  forceinline bool
+  EventByKey::operator ()(const int& i, const int& j) const {
+    return e[i] < e[j];
+  }
+
+
+  forceinline
+  EventOrder::EventOrder(void) : o(nullptr), n(0) {}
+
+  forceinline void
+  EventOrder::update(Space& home, const EventOrder& eo) {
+    n = eo.n;
+    if (n > 0) {
+      o = home.alloc<int>(n);
+      for (int i=0; i<n; i++)
+        o[i] = eo.o[i];
+    } else {
+      o = nullptr;
+    }
+  }
+
+  forceinline void
+  EventOrder::dispose(Space& home) {
+    if (n > 0)
+      home.free<int>(o,n);
+    o = nullptr; n = 0;
+  }
+
+  template<class Task>
+  forceinline Event*
+  EventOrder::events(Space& home, Region& r, const TaskArray<Task>& t,
+                     bool& assigned, bool reset) {
+    int m = 4*t.size();
+    if (n != m) {
+      dispose(home);
+      o = home.alloc<int>(m); n = m;
+      for (int i=0; i<m; i++)
+        o[i] = i;
+      reset = true;
+    }
+
+    // Events indexed by key, including events that are currently invalid
+    Event* k = r.alloc<Event>(m);
+    Support::BitSet<Region> valid(r,static_cast<unsigned int>(m));
+
+    assigned=true;
+    bool required=false;
+
+    for (int i=0; i<t.size(); i++) {
+      k[4*i+EK_START].init(Event::EST,t[i].est(),i);
+      k[4*i+EK_END].init(Event::LCT,t[i].lct(),i);
+      k[4*i+EK_RSTART].init(Event::ERT,t[i].lst(),i);
+      k[4*i+EK_REND].init(Event::LRT,t[i].ect(),i);
+      if (t[i].assigned()) {
+        // Only add required part
+        if (t[i].pmin() > 0) {
+          required = true;
+          valid.set(static_cast<unsigned int>(4*i+EK_RSTART));
+          valid.set(static_cast<unsigned int>(4*i+EK_REND));
+        } else if (t[i].pmax() == 0) {
+          required = true;
+          k[4*i+EK_RSTART].init(Event::ZRO,t[i].lst(),i);
+          valid.set(static_cast<unsigned int>(4*i+EK_RSTART));
+        }
+      } else {
+        assigned = false;
+        valid.set(static_cast<unsigned int>(4*i+EK_START));
+        valid.set(static_cast<unsigned int>(4*i+EK_END));
+        // Check whether task has required part
+        if (t[i].lst() < t[i].ect()) {
+          required = true;
+          valid.set(static_cast<unsigned int>(4*i+EK_RSTART));
+          valid.set(static_cast<unsigned int>(4*i+EK_REND));
+        }
+      }
+    }
+
+    if (!required)
+      return nullptr;
+
+    // Repair the order by insertion sort, give up if too many events move
+    if (!reset) {
+      int b = budget * m;
+      for (int j=1; j<m; j++) {
+        int v = o[j], l = j;
+        while ((l > 0) && (k[v] < k[o[l-1]])) {
+          o[l] = o[l-1]; l--;
+        }
+        o[l] = v;
+        b -= j-l;
+        if (b < 0) {
+          reset = true; break;
+        }
+      }
+    }
+    if (reset) {
+      EventByKey ebk(k);
+      Support::quicksort(o, m, ebk);
+    }
+
+    // Only keep valid events
+    Event* e = r.alloc<Event>(m+1);
+    int j=0;
+    for (int i=0; i<m; i++)
+      if (valid.get(static_cast<unsigned int>(o[i])))
+        e[j++] = k[o[i]];
+
+    // Write end marker
+    e[j].init(Event::END,Limits::infinity,0);
+
+    return e;
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -37,21 +37,24 @@ namespace Gecode { namespace Int { namespace Cumulative {
 
   template<class ManTask, class Cap, class PL>
   forceinline
-  ManProp<ManTask,Cap,PL>::ManProp(Home home, Cap c0, TaskArray<ManTask>& t)
-    : TaskProp<ManTask,PL>(home,t), c(c0) {
+  ManProp<ManTask,Cap,PL>::ManProp(Home home, Cap c0, TaskArray<ManTask>& t,
+                                   int ep0)
+    : TaskProp<ManTask,PL>(home,t), c(c0), ep(ep0) {
     c.subscribe(home,*this,PC_INT_BND);
   }
 
   template<class ManTask, class Cap, class PL>
   forceinline
   ManProp<ManTask,Cap,PL>::ManProp(Space& home, ManProp<ManTask,Cap,PL>& p)
-    : TaskProp<ManTask,PL>(home,p) {
+    : TaskProp<ManTask,PL>(home,p), ep(p.ep) {
     c.update(home,p.c);
+    eo.update(home,p.eo);
   }
 
   template<class ManTask, class Cap, class PL>
   ExecStatus
-  ManProp<ManTask,Cap,PL>::post(Home home, Cap c, TaskArray<ManTask>& t) {
+  ManProp<ManTask,Cap,PL>::post(Home home, Cap c, TaskArray<ManTask>& t,
+                                int ep) {
     // Capacity must be nonnegative
     GECODE_ME_CHECK(c.gq(home, 0));
     // Check that tasks do not overload resource
@@ -68,7 +71,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
         return Unary::ManProp<typename TaskTraits<ManTask>::UnaryTask,PL>
           ::post(home,mt);
       } else {
-        (void) new (home) ManProp<ManTask,Cap,PL>(home,c,t);
+        (void) new (home) ManProp<ManTask,Cap,PL>(home,c,t,ep);
       }
     }
     return ES_OK;
@@ -85,6 +88,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
   ManProp<ManTask,Cap,PL>::dispose(Space& home) {
     (void) TaskProp<ManTask,PL>::dispose(home);
     c.cancel(home,*this,PC_INT_BND);
+    eo.dispose(home);
     return sizeof(*this);
   }
 
@@ -98,8 +102,14 @@ namespace Gecode { namespace Int { namespace Cumulative {
     if (PL::advanced)
       GECODE_ES_CHECK(edgefinding(home,c.max(),t));
 
+    if (ep & EP_TTEF)
+      GECODE_ES_CHECK(ttef(home,c.max(),t));
+
+    if (ep & EP_ENERGETIC)
+      GECODE_ES_CHECK(energetic(home,c.max(),t));
+
     if (PL::basic)
-      GECODE_ES_CHECK(timetabling(home,*this,c,t));
+      GECODE_ES_CHECK(timetabling(home,*this,c,t,eo));
 
     if (Cap::varderived() && c.assigned() && (c.val() == 1)) {
       // Check that tasks do not overload resource
@@ -39,21 +39,24 @@ namespace Gecode { namespace Int { namespace Cumulative {
 
   template<class OptTask, class Cap, class PL>
   forceinline
-  OptProp<OptTask,Cap,PL>::OptProp(Home home, Cap c0, TaskArray<OptTask>& t)
-    : TaskProp<OptTask,PL>(home,t), c(c0) {
+  OptProp<OptTask,Cap,PL>::OptProp(Home home, Cap c0, TaskArray<OptTask>& t,
+                                   int ep0)
+    : TaskProp<OptTask,PL>(home,t), c(c0), ep(ep0) {
     c.subscribe(home,*this,PC_INT_BND);
   }
 
   template<class OptTask, class Cap, class PL>
   forceinline
   OptProp<OptTask,Cap,PL>::OptProp(Space& home, OptProp<OptTask,Cap,PL>& p)
-    : TaskProp<OptTask,PL>(home,p) {
+    : TaskProp<OptTask,PL>(home,p), ep(p.ep) {
     c.update(home,p.c);
+    eo.update(home,p.eo);
   }
 
   template<class OptTask, class Cap, class PL>
   ExecStatus
-  OptProp<OptTask,Cap,PL>::post(Home home, Cap c, TaskArray<OptTask>& t) {
+  OptProp<OptTask,Cap,PL>::post(Home home, Cap c, TaskArray<OptTask>& t,
+                                int ep) {
     // Capacity must be nonnegative
     GECODE_ME_CHECK(c.gq(home, 0));
     // Check for overload by single task and remove excluded tasks
@@ -91,9 +94,9 @@ namespace Gecode { namespace Int { namespace Cumulative {
       for (int i=0; i<m; i++)
         mt[i].init(t[i]);
       return ManProp<typename TaskTraits<OptTask>::ManTask,Cap,PL>
-        ::post(home,c,mt);
+        ::post(home,c,mt,ep);
     }
-    (void) new (home) OptProp<OptTask,Cap,PL>(home,c,t);
+    (void) new (home) OptProp<OptTask,Cap,PL>(home,c,t,ep);
     return ES_OK;
   }
 
@@ -108,6 +111,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
   OptProp<OptTask,Cap,PL>::dispose(Space& home) {
     (void) TaskProp<OptTask,PL>::dispose(home);
     c.cancel(home,*this,PC_INT_BND);
+    eo.dispose(home);
     return sizeof(*this);
   }
 
@@ -123,9 +127,9 @@ namespace Gecode { namespace Int { namespace Cumulative {
       GECODE_ES_CHECK(overload(home,c.max(),t));
 
     if (PL::basic)
-      GECODE_ES_CHECK(timetabling(home,*this,c,t));
+      GECODE_ES_CHECK(timetabling(home,*this,c,t,eo));
 
-    if (PL::advanced) {
+    if (PL::advanced || (ep != EP_NONE)) {
       // Partition into mandatory and optional activities
       int n = t.size();
       int i=0, j=n-1;
@@ -139,7 +143,12 @@ namespace Gecode { namespace Int { namespace Cumulative {
       if (i > 1) {
         // Truncate array to only contain mandatory tasks
         t.size(i);
-        GECODE_ES_CHECK(edgefinding(home,c.max(),t));
+        if (PL::advanced)
+          GECODE_ES_CHECK(edgefinding(home,c.max(),t));
+        if (ep & EP_TTEF)
+          GECODE_ES_CHECK(ttef(home,c.max(),t));
+        if (ep & EP_ENERGETIC)
+          GECODE_ES_CHECK(energetic(home,c.max(),t));
         // Restore to also include optional tasks
         t.size(n);
       }
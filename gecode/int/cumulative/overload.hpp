@@ -40,12 +40,17 @@ namespace Gecode { namespace Int { namespace Cumulative {
   ExecStatus
   overload(Space& home, int c, TaskArray<ManTask>& t) {
     TaskViewArray<typename TaskTraits<ManTask>::TaskViewFwd> f(t);
-    sort<typename TaskTraits<ManTask>::TaskViewFwd,STO_LCT,true>(f);
 
     Region r;
+
+    // Sort a map rather than the tasks to keep their order (time-tabling)
+    int* lct = r.alloc<int>(f.size());
+    sort<typename TaskTraits<ManTask>::TaskViewFwd,STO_LCT,true>(lct,f);
+
     OmegaTree<typename TaskTraits<ManTask>::TaskViewFwd> o(r,c,f);
 
-    for (int i=0; i<f.size(); i++) {
+    for (int j=0; j<f.size(); j++) {
+      int i = lct[j];
       if (f[i].mandatory())
         o.insert(i);
       if (o.env() > static_cast<long long int>(c)*f[i].lct())
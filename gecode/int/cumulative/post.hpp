@@ -33,16 +33,29 @@
 
 namespace Gecode { namespace Int { namespace Cumulative {
 
+  forceinline int
+  extprop(IntPropLevel ipl) {
+    switch (vbd(ipl)) {
+    case IPL_BND:
+      return EP_TTEF;
+    case IPL_DOM:
+      return EP_TTEF | EP_ENERGETIC;
+    default:
+      return EP_NONE;
+    }
+  }
+
   template<class ManTask, class Cap>
   forceinline ExecStatus
   manpost(Home home, Cap c, TaskArray<ManTask>& t, IntPropLevel ipl) {
+    int ep = extprop(ipl);
     switch (ba(ipl)) {
     case IPL_BASIC: default:
-      return ManProp<ManTask,Cap,PLB>::post(home,c,t);
+      return ManProp<ManTask,Cap,PLB>::post(home,c,t,ep);
     case IPL_ADVANCED:
-      return ManProp<ManTask,Cap,PLA>::post(home,c,t);
+      return ManProp<ManTask,Cap,PLA>::post(home,c,t,ep);
     case IPL_BASIC_ADVANCED:
-      return ManProp<ManTask,Cap,PLBA>::post(home,c,t);
+      return ManProp<ManTask,Cap,PLBA>::post(home,c,t,ep);
     }
     GECODE_NEVER;
     return ES_OK;
@@ -51,13 +64,14 @@ namespace Gecode { namespace Int { namespace Cumulative {
   template<class OptTask, class Cap>
   forceinline ExecStatus
   optpost(Home home, Cap c, TaskArray<OptTask>& t, IntPropLevel ipl) {
+    int ep = extprop(ipl);
     switch (ba(ipl)) {
     case IPL_BASIC: default:
-      return OptProp<OptTask,Cap,PLB>::post(home,c,t);
+      return OptProp<OptTask,Cap,PLB>::post(home,c,t,ep);
     case IPL_ADVANCED:
-      return OptProp<OptTask,Cap,PLA>::post(home,c,t);
+      return OptProp<OptTask,Cap,PLA>::post(home,c,t,ep);
     case IPL_BASIC_ADVANCED:
-      return OptProp<OptTask,Cap,PLBA>::post(home,c,t);
+      return OptProp<OptTask,Cap,PLBA>::post(home,c,t,ep);
     }
     GECODE_NEVER;
     return ES_OK;
@@ -52,19 +52,26 @@ namespace Gecode { namespace Int { namespace Cumulative {
   // Basic propagation (timetabling)
   template<class Task, class Cap>
   forceinline ExecStatus
-  timetabling(Space& home, Propagator& p, Cap c, TaskArray<Task>& t) {
+  timetabling(Space& home, Propagator& p, Cap c, TaskArray<Task>& t,
+              EventOrder& eo) {
     int ccur = c.max();
     int cmax = ccur;
     int cmin = ccur;
 
-    // Sort tasks by decreasing capacity
+    // Sort tasks by decreasing capacity, unless they are already sorted
     TaskByDecCap<Task> tbdc;
-    Support::quicksort(&t[0], t.size(), tbdc);
+    bool reset = false;
+    for (int i=1; i<t.size(); i++)
+      if (tbdc(t[i],t[i-1])) {
+        reset = true; break;
+      }
+    if (reset)
+      Support::quicksort(&t[0], t.size(), tbdc);
 
     Region r;
 
     bool assigned;
-    if (Event* e = Event::events(r,t,assigned)) {
+    if (Event* e = eo.events(home,r,t,assigned,reset)) {
       // Set of current but not required tasks
       Support::BitSet<Region> tasks(r,static_cast<unsigned int>(t.size()));
 
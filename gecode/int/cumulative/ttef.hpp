@@ -0,0 +1,226 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2010
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Cumulative {
+
+  /// Length of the overlap of the intervals [\a s, \a e) and [\a a, \a b)
+  forceinline long long int
+  overlap(int s, int e, int a, int b) {
+    return std::max(0LL, static_cast<long long int>(std::min(e,b)) -
+                         static_cast<long long int>(std::max(s,a)));
+  }
+
+  /**
+   * \brief Snapshot of a task for energy-based reasoning
+   *
+   * Energy-based reasoning must not mix information from before and
+   * after pruning (the time-table is computed from the snapshot).
+   */
+  class TaskEnergy {
+  public:
+    /// Earliest start, latest start, earliest completion, latest completion
+    int est, lst, ect, lct;
+    /// Minimal processing time
+    int p;
+    /// Required capacity
+    int c;
+    /// Initialize from task \a t
+    template<class TaskView>
+    void init(const TaskView& t);
+    /// Return length of required part
+    int required(void) const;
+    /// Return energy not within the required part
+    long long int free(void) const;
+    /// Return energy in [\a a, \a b) if left-shifted, not within the required part
+    long long int lfree(int a, int b) const;
+  };
+
+  template<class TaskView>
+  forceinline void
+  TaskEnergy::init(const TaskView& t) {
+    est=t.est(); lst=t.lst(); ect=t.ect(); lct=t.lct(); p=t.pmin(); c=t.c();
+  }
+  forceinline int
+  TaskEnergy::required(void) const {
+    return std::max(0, ect - lst);
+  }
+  forceinline long long int
+  TaskEnergy::free(void) const {
+    return static_cast<long long int>(c) * std::max(0, p - required());
+  }
+  forceinline long long int
+  TaskEnergy::lfree(int a, int b) const {
+    return c * overlap(est, std::min(lst,ect), a, b);
+  }
+
+
+  /// Time-table (profile of required parts) for energy queries
+  class TimeTable {
+  protected:
+    /// Number of breakpoints
+    int n;
+    /// Times of the breakpoints in increasing order
+    int* tm;
+    /// Height of the time-table starting at a breakpoint
+    long long int* h;
+    /// Energy of the time-table before a breakpoint
+    long long int* en;
+    /// Return energy of the time-table before time \a x
+    long long int energy(int x) const;
+  public:
+    /// Initialize from required parts of the \a m tasks \a t
+    TimeTable(Region& r, const TaskEnergy* t, int m);
+    /// Return energy of the time-table in [\a a, \a b)
+    long long int energy(int a, int b) const;
+  };
+
+  forceinline
+  TimeTable::TimeTable(Region& r, const TaskEnergy* t, int m) : n(0) {
+    // Start and end of required parts
+    Event* e = r.alloc<Event>(2*m);
+    int k = 0;
+    for (int i=0; i<m; i++)
+      if (t[i].lst < t[i].ect) {
+        e[k++].init(Event::ERT,t[i].lst,i);
+        e[k++].init(Event::LRT,t[i].ect,i);
+      }
+    Support::quicksort(e, k);
+    tm = r.alloc<int>(k);
+    h = r.alloc<long long int>(k);
+    en = r.alloc<long long int>(k);
+    long long int ch = 0, ce = 0;
+    for (int j=0; j<k; j++) {
+      int x = e[j].time();
+      if ((n > 0) && (tm[n-1] == x))
+        n--;
+      else if (n > 0)
+        ce += ch * (static_cast<long long int>(x) - tm[n-1]);
+      if (e[j].type() == Event::ERT)
+        ch += t[e[j].idx()].c;
+      else
+        ch -= t[e[j].idx()].c;
+      tm[n] = x; h[n] = ch; en[n] = ce; n++;
+    }
+  }
+
+  forceinline long long int
+  TimeTable::energy(int x) const {
+    int* k = std::upper_bound(tm, tm+n, x);
+    if (k == tm)
+      return 0;
+    int i = static_cast<int>(k - tm) - 1;
+    return en[i] + h[i] * (static_cast<long long int>(x) - tm[i]);
+  }
+
+  forceinline long long int
+  TimeTable::energy(int a, int b) const {
+    return energy(b) - energy(a);
+  }
+
+
+  template<class TaskView>
+  ExecStatus
+  ttef(Space& home, int c, TaskViewArray<TaskView>& t) {
+    int n = t.size();
+    Region r;
+
+    TaskEnergy* s = r.alloc<TaskEnergy>(n);
+    // Maximal energy a single task can require beyond its required part
+    long long int emax = 0;
+    for (int i=0; i<n; i++) {
+      s[i].init(t[i]);
+      emax = std::max(emax, s[i].lfree(s[i].est, s[i].lct));
+    }
+    if (emax == 0)
+      return ES_OK;
+
+    TimeTable tt(r, s, n);
+
+    int* est = r.alloc<int>(n);
+    sort<TaskView,STO_EST,true>(est, t);
+    int* lct = r.alloc<int>(n);
+    sort<TaskView,STO_LCT,true>(lct, t);
+
+    // Iterate over all windows [a,b) with a an est and b an lct
+    for (int j=n; j--; ) {
+      int b = s[lct[j]].lct;
+      if ((j+1 < n) && (s[lct[j+1]].lct == b))
+        continue;
+      // Energy of free parts of tasks inside the window
+      long long int ef = 0;
+      for (int i=n; i--; ) {
+        if (s[est[i]].lct <= b)
+          ef += s[est[i]].free();
+        int a = s[est[i]].est;
+        if (((i > 0) && (s[est[i-1]].est == a)) || (a >= b))
+          continue;
+        // Energy still available in the window
+        long long int avail =
+          static_cast<long long int>(c) * (static_cast<long long int>(b) - a)
+          - ef - tt.energy(a,b);
+        if (avail < 0)
+          return ES_FAILED;
+        if (avail >= emax)
+          continue;
+        for (int u=0; u<n; u++) {
+          if ((s[u].est >= a) && (s[u].lct <= b))
+            continue;
+          if (s[u].lfree(a,b) > avail) {
+            // Energy available to u, including its own required part
+            long long int w = avail + s[u].c * overlap(s[u].lst,s[u].ect,a,b);
+            long long int nest = a;
+            if (s[u].p > w / s[u].c)
+              nest = std::max(nest, b - w / s[u].c);
+            GECODE_ME_CHECK(t[u].est(home,static_cast<int>(nest)));
+          }
+        }
+      }
+    }
+    return ES_OK;
+  }
+
+  template<class Task>
+  ExecStatus
+  ttef(Space& home, int c, TaskArray<Task>& t) {
+    TaskViewArray<typename TaskTraits<Task>::TaskViewFwd> f(t);
+    GECODE_ES_CHECK(ttef(home,c,f));
+    TaskViewArray<typename TaskTraits<Task>::TaskViewBwd> b(t);
+    GECODE_ES_CHECK(ttef(home,c,b));
+    return ES_OK;
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -54,7 +54,8 @@ namespace Gecode {
       GECODE_ES_FAIL(Distinct::Bnd<IntView>::post(home,xv));
       break;
     case IPL_DOM:
-      GECODE_ES_FAIL(Distinct::Dom<IntView>::post(home,xv));
+      GECODE_ES_FAIL(Distinct::Dom<IntView>::post(home,xv,
+                                                  (ipl & IPL_ADVANCED) != 0));
       break;
     default:
       GECODE_ES_FAIL(Distinct::Val<IntView>::post(home,xv));
@@ -86,7 +87,8 @@ namespace Gecode {
       GECODE_ES_FAIL(Distinct::Bnd<OffsetView>::post(home,cx));
       break;
     case IPL_DOM:
-      GECODE_ES_FAIL(Distinct::Dom<OffsetView>::post(home,cx));
+      GECODE_ES_FAIL(Distinct::Dom<OffsetView>::post(home,cx,
+                                                     (ipl & IPL_ADVANCED) != 0));
       break;
     default:
       GECODE_ES_FAIL(Distinct::Val<OffsetView>::post(home,cx));
@@ -226,8 +226,14 @@ namespace Gecode { namespace Int { namespace Distinct {
     using ViewValGraph::Graph<View>::match;
     /// Construct graph as not yet initialized
     Graph(void);
-    /// Initialize graph
-    ExecStatus init(Space& home, ViewArray<View>& x);
+    /**
+     * \brief Initialize graph
+     *
+     * If \a mv is not nullptr, views are matched to the values \a mv
+     * first (if possible) before the remaining views are matched.
+     */
+    ExecStatus init(Space& home, ViewArray<View>& x,
+                    const int* mv = nullptr);
     /// Mark edges in graph, return true if pruning is at all possible
     bool mark(void);
     /// Prune unmarked edges, \a assigned is true if a view got assigned
@@ -251,9 +257,37 @@ namespace Gecode { namespace Int { namespace Distinct {
   protected:
     /// Propagation is performed on a view-value graph
     Graph<View> g;
+    /// Matching kept during cloning
+    class Match {
+    public:
+      /// Variable implementation of a view
+      typename View::VarImpType* x;
+      /// Value the view has been matched to
+      int v;
+      /// Order by variable implementation
+      bool operator <(const Match& m) const;
+    };
+    /// Matching kept during cloning (sorted)
+    Match* m;
+    /// Number of views in kept matching
+    int n_m;
+    /// Whether to keep the matching during cloning
+    bool km;
   public:
-    /// Initialize with non-initialized view-value graph
-    DomCtrl(void);
+    /**
+     * \brief Initialize with non-initialized view-value graph
+     *
+     * If \a km is true, the matching is kept during cloning.
+     */
+    DomCtrl(bool km=false);
+    /**
+     * \brief Update during cloning
+     *
+     * If requested, only the matching of \a dc is kept (as values for
+     * variable implementations), it is used as a starting point when
+     * the view-value graph is initialized the next time.
+     */
+    void update(Space& home, DomCtrl<View>& dc);
     /// Check whether a view-value graph is available
     bool available(void);
     /// Initialize view-value graph for views \a x
@@ -287,8 +321,8 @@ namespace Gecode { namespace Int { namespace Distinct {
     DomCtrl<View> dc;
     /// Constructor for cloning \a p
     Dom(Space& home, Dom<View>& p);
-    /// Constructor for posting
-    Dom(Home home, ViewArray<View>& x);
+    /// Constructor for posting (keep matching during cloning if \a km)
+    Dom(Home home, ViewArray<View>& x, bool km);
   public:
 #ifdef GECODE_HAS_CBS
     /// Solution distribution computation for branching
@@ -308,8 +342,8 @@ namespace Gecode { namespace Int { namespace Distinct {
     virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
     /// Copy propagator during cloning
     virtual Actor* copy(Space& home);
-    /// Post propagator for views \a x
-    static ExecStatus post(Home home, ViewArray<View>& x);
+    /// Post propagator for views \a x (keep matching during cloning if \a km)
+    static ExecStatus post(Home home, ViewArray<View>& x, bool km=false);
   };
 
   /**
@@ -32,6 +32,8 @@
  */
 
 #include <climits>
+#include <algorithm>
+#include <functional>
 
 namespace Gecode { namespace Int { namespace Distinct {
 
@@ -40,9 +42,45 @@ namespace Gecode { namespace Int { namespace Distinct {
    *
    */
 
+  template<class View>
+  forceinline bool
+  DomCtrl<View>::Match::operator <(const Match& mt) const {
+    return std::less<typename View::VarImpType*>()(x,mt.x);
+  }
+
   template<class View>
   forceinline
-  DomCtrl<View>::DomCtrl(void) {}
+  DomCtrl<View>::DomCtrl(bool km0) : m(nullptr), n_m(0), km(km0) {}
+
+  template<class View>
+  forceinline void
+  DomCtrl<View>::update(Space& home, DomCtrl<View>& dc) {
+    km = dc.km;
+    if (!km)
+      return;
+    // This assumes that all unassigned views have already been updated
+    if (dc.available()) {
+      m = home.alloc<Match>(dc.g.n_view);
+      for (int i=0; i<dc.g.n_view; i++) {
+        View y = dc.g.view[i]->view();
+        if (!y.assigned()) {
+          View z; z.update(home,y);
+          m[n_m].x = z.varimp();
+          m[n_m].v = dc.g.view[i]->edge_fst()->val(dc.g.view[i])->val();
+          n_m++;
+        }
+      }
+    } else if (dc.n_m > 0) {
+      // The kept matching has not been used yet
+      m = home.alloc<Match>(dc.n_m);
+      for (int i=0; i<dc.n_m; i++)
+        if (!dc.m[i].x->assigned()) {
+          m[n_m].x = dc.m[i].x->copy(home);
+          m[n_m].v = dc.m[i].v;
+          n_m++;
+        }
+    }
+  }
 
   template<class View>
   forceinline bool
@@ -53,7 +91,19 @@ namespace Gecode { namespace Int { namespace Distinct {
   template<class View>
   ExecStatus
   DomCtrl<View>::init(Space& home, ViewArray<View>& x) {
-    return g.init(home,x);
+    if (n_m == 0)
+      return g.init(home,x);
+    // Try to reuse the kept matching
+    Support::quicksort<Match>(m,n_m);
+    Region r;
+    int* mv = r.alloc<int>(x.size());
+    for (int i=0; i<x.size(); i++) {
+      Match k; k.x = x[i].varimp();
+      Match* f = std::lower_bound(m,m+n_m,k);
+      mv[i] = ((f < m+n_m) && (f->x == k.x)) ? f->v : x[i].min();
+    }
+    n_m = 0;
+    return g.init(home,x,mv);
   }
 
   template<class View>
@@ -37,12 +37,12 @@ namespace Gecode { namespace Int { namespace Distinct {
 
   template<class View>
   forceinline
-  Dom<View>::Dom(Home home, ViewArray<View>& x)
-    : NaryPropagator<View,PC_INT_DOM>(home,x) {}
+  Dom<View>::Dom(Home home, ViewArray<View>& x, bool km)
+    : NaryPropagator<View,PC_INT_DOM>(home,x), dc(km) {}
 
   template<class View>
   ExecStatus
-  Dom<View>::post(Home home, ViewArray<View>& x) {
+  Dom<View>::post(Home home, ViewArray<View>& x, bool km) {
     if (x.size() == 2)
       return Rel::Nq<View,View>::post(home,x[0],x[1]);
     if (x.size() == 3)
@@ -50,7 +50,7 @@ namespace Gecode { namespace Int { namespace Distinct {
     if (x.size() > 3) {
       // Do bounds propagation to make view-value graph smaller
       GECODE_ES_CHECK(prop_bnd<View>(home,x));
-      (void) new (home) Dom<View>(home,x);
+      (void) new (home) Dom<View>(home,x,km);
     }
     return ES_OK;
   }
@@ -58,7 +58,9 @@ namespace Gecode { namespace Int { namespace Distinct {
   template<class View>
   forceinline
   Dom<View>::Dom(Space& home, Dom<View>& p)
-    : NaryPropagator<View,PC_INT_DOM>(home,p) {}
+    : NaryPropagator<View,PC_INT_DOM>(home,p) {
+    dc.update(home,p.dc);
+  }
 
   template<class View>
   PropCost
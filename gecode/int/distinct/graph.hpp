@@ -41,7 +41,7 @@ namespace Gecode { namespace Int { namespace Distinct {
 
   template<class View>
   forceinline ExecStatus
-  Graph<View>::init(Space& home, ViewArray<View>& x) {
+  Graph<View>::init(Space& home, ViewArray<View>& x, const int* mv) {
     using namespace ViewValGraph;
     n_view = x.size();
     view = home.alloc<ViewNode<View>*>(n_view);
@@ -100,9 +100,26 @@ namespace Gecode { namespace Int { namespace Distinct {
     if (n_val < n_view)
       return ES_FAILED;
 
+    // Which views are already matched
+    bool* matched = r.alloc<bool>(n_view);
+    for (int i=0; i<n_view; i++)
+      matched[i] = false;
+    if (mv != nullptr)
+      for (int i=0; i<n_view; i++)
+        for (Edge<View>* e = view[i]->val_edges(); e != nullptr;
+             e = e->next_edge())
+          if (e->val(view[i])->val() >= mv[i]) {
+            if ((e->val(view[i])->val() == mv[i]) &&
+                !e->val(view[i])->matching()) {
+              e->revert(view[i]); e->val(view[i])->matching(e);
+              matched[i] = true;
+            }
+            break;
+          }
+
     typename ViewValGraph::Graph<View>::ViewNodeStack m(r,n_view);
     for (int i=0; i<n_view; i++)
-      if (!match(m,view[i]))
+      if (!matched[i] && !match(m,view[i]))
         return ES_FAILED;
     return ES_OK;
   }
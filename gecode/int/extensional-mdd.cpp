@@ -0,0 +1,65 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2020
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/int/extensional.hh>
+
+namespace Gecode {
+
+  void
+  extensional(Home home, const IntVarArgs& x, const MDD& m,
+              IntPropLevel) {
+    using namespace Int;
+    if (x.size() != m.arity())
+      throw ArgumentSizeMismatch("Int::extensional");
+    if (same(x))
+      throw ArgumentSame("Int::extensional");
+    GECODE_POST;
+    GECODE_ES_FAIL(Extensional::post_lgp(home,x,m));
+  }
+
+  void
+  extensional(Home home, const BoolVarArgs& x, const MDD& m,
+              IntPropLevel) {
+    using namespace Int;
+    if (x.size() != m.arity())
+      throw ArgumentSizeMismatch("Int::extensional");
+    if (same(x))
+      throw ArgumentSame("Int::extensional");
+    GECODE_POST;
+    GECODE_ES_FAIL(Extensional::post_lgp(home,x,m));
+  }
+
+}
+
+// STATISTICS: int-post
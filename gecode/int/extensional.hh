@@ -57,6 +57,10 @@ namespace Gecode { namespace Int { namespace Extensional {
    *   for Finite Sequences of Variables, CP 2004.
    *   Pages 482-495, LNCS 3258, Springer-Verlag, 2004.
    *
+   * The layered graph is either obtained by unfolding a DFA or it is
+   * given directly by the layers of an MDD. For an MDD, the states of
+   * a layer are the nodes of the corresponding MDD layer.
+   *
    * The propagator is not capable of dealing with multiple occurrences
    * of the same view.
    *
@@ -186,6 +190,12 @@ namespace Gecode { namespace Int { namespace Extensional {
     template<class Var>
     ExecStatus initialize(Space& home,
                           const VarArgArray<Var>& x, const DFA& dfa);
+    /// Initialize layered graph
+    template<class Var>
+    ExecStatus initialize(Space& home,
+                          const VarArgArray<Var>& x, const MDD& mdd);
+    /// Prune edges not leading to a final state, tell domains, and compress states
+    ExecStatus complete(Space& home);
     /// Constructor for cloning \a p
     LayeredGraph(Space& home, LayeredGraph<View,Val,Degree,StateIdx>& p);
   public:
@@ -193,6 +203,10 @@ namespace Gecode { namespace Int { namespace Extensional {
     template<class Var>
     LayeredGraph(Home home,
                  const VarArgArray<Var>& x, const DFA& dfa);
+    /// Constructor for posting
+    template<class Var>
+    LayeredGraph(Home home,
+                 const VarArgArray<Var>& x, const MDD& mdd);
     /// Copy propagator during cloning
     virtual Actor* copy(Space& home);
     /// Cost function (defined as high linear)
@@ -209,13 +223,30 @@ namespace Gecode { namespace Int { namespace Extensional {
     template<class Var>
     static ExecStatus post(Home home,
                            const VarArgArray<Var>& x, const DFA& dfa);
+    /// Post propagator on views \a x and MDD \a mdd
+    template<class Var>
+    static ExecStatus post(Home home,
+                           const VarArgArray<Var>& x, const MDD& mdd);
   };
 
+  /// Post layered graph propagator for \a g with types \a t_val, \a t_state_idx, and \a t_degree
+  template<class Var, class Graph>
+  ExecStatus post_lgp(Home home,
+                      const VarArgArray<Var>& x, const Graph& g,
+                      Gecode::Support::IntType t_val,
+                      Gecode::Support::IntType t_state_idx,
+                      Gecode::Support::IntType t_degree);
+
   /// Select small types for the layered graph propagator
   template<class Var>
   ExecStatus post_lgp(Home home,
                       const VarArgArray<Var>& x, const DFA& dfa);
 
+  /// Select small types for the layered graph propagator
+  template<class Var>
+  ExecStatus post_lgp(Home home,
+                      const VarArgArray<Var>& x, const MDD& mdd);
+
 }}}
 
 #include <gecode/int/extensional/layered-graph.hpp>
@@ -575,6 +606,10 @@ namespace Gecode { namespace Int { namespace Extensional {
   template<class View>
   ExecStatus postposcompact(Home home, ViewArray<View>& x, const TupleSet& ts);
 
+  /// Expand compressed tuple set \a ts to ground tuples with values of \a x
+  template<class View>
+  TupleSet expand(const ViewArray<View>& x, const TupleSet& ts);
+
   /**
    * \brief Domain consistent negative extensional propagator
    *
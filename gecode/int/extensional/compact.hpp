@@ -239,23 +239,22 @@ namespace Gecode { namespace Int { namespace Extensional {
   Compact<View,pos>::ValidSupports::operator ++(void) {
     n++;
     if (pos) {
-      if (n <= xr.max()) {
-        assert(n <= sr->max);
-        s += n_words;
+      if ((n <= xr.max()) && (n <= sr->max)) {
+        s += sr->step;
       } else if (n <= max) {
+        // Ranges of compressed tuple sets can be adjacent
         while (n > xr.max())
           ++xr;
-        n = xr.min();
+        n = std::max(n,xr.min());
         while (n > sr->max)
           sr++;
         s = sr->supports(n_words,n);
         assert((xr.min() <= n) && (n <= xr.max()));
         assert((sr->min <= n) && (n <= sr->max));
-        assert(sr->min <= xr.min());
       }
     } else {
       if ((n <= sr->max) && (n <= xr.max())) {
-        s += n_words;
+        s += sr->step;
       } else if (n <= max) {
         find();
       }
@@ -297,7 +296,7 @@ namespace Gecode { namespace Int { namespace Extensional {
   template<class View, bool pos>
   forceinline void
   Compact<View,pos>::LostSupports::operator ++(void) {
-    l++; s += n_words;
+    l++; s += r->step;
     while ((l <= h) && (l > r->max)) {
       r++; l=r->min; s=r->s;
     }
@@ -355,8 +354,11 @@ namespace Gecode { namespace Int { namespace Extensional {
     // Invalidate tuples
     for (int i=0; i<x.size(); i++) {
       table.clear_mask(mask);
+      const BitSetData* s = nullptr;
       for (ValidSupports vs(ts,i,x[i]); vs(); ++vs)
-        table.add_to_mask(vs.supports(),mask);
+        // Values of compressed tuple sets can share supports
+        if (vs.supports() != s)
+          table.add_to_mask(s = vs.supports(),mask);
       table.template intersect_with_mask<false>(mask);
       // The propagator must be scheduled for subsumption
       if (table.empty())
@@ -578,11 +580,17 @@ namespace Gecode { namespace Int { namespace Extensional {
         unsigned int n_nq = 0;
         // The initialization is here just to avoid warnings...
         int last_support = 0;
-        for (ValidSupports vs(*this,a); vs(); ++vs)
-          if (!table.intersects(vs.supports()))
+        // Values of compressed tuple sets can share supports
+        const BitSetData* s = nullptr;
+        bool supported = false;
+        for (ValidSupports vs(*this,a); vs(); ++vs) {
+          if (vs.supports() != s)
+            supported = table.intersects(s = vs.supports());
+          if (!supported)
             nq[n_nq++] = vs.val();
           else
             last_support = vs.val();
+        }
         // Remove collected values
         if (n_nq > 0U) {
           if (n_nq == 1U) {
@@ -638,10 +646,17 @@ namespace Gecode { namespace Int { namespace Extensional {
       return home.ES_NOFIX_DISPOSE(c,a);
     }
       
-    if (!x.any(d) && (x.min(d) == x.max(d))) {
+    /*
+     * A tuple of a compressed tuple set is not invalidated by removing
+     * one of its values, hence compressed tuple sets always use the
+     * reset-based update.
+     */
+    bool delta = !ts.compressed() && !x.any(d);
+
+    if (delta && (x.min(d) == x.max(d))) {
       table.nand_with_mask(supports(a,x.min(d)));
       a.adjust();
-    } else if (!x.any(d) && (x.width(d) <= x.size())) {
+    } else if (delta && (x.width(d) <= x.size())) {
       // Incremental update, using the removed values
       for (LostSupports ls(*this,a,x.min(d),x.max(d)); ls(); ++ls) {
         table.nand_with_mask(ls.supports());
@@ -661,8 +676,10 @@ namespace Gecode { namespace Int { namespace Extensional {
         BitSetData* mask = r.alloc<BitSetData>(table.size());
         // Collect all tuples to be kept in a temporary mask
         table.clear_mask(mask);
+        const BitSetData* s = nullptr;
         for (ValidSupports vs(*this,a); vs(); ++vs)
-          table.add_to_mask(vs.supports(),mask);
+          if (vs.supports() != s)
+            table.add_to_mask(s = vs.supports(),mask);
         table.template intersect_with_mask<false>(mask);
       }
     }
@@ -947,6 +964,55 @@ namespace Gecode { namespace Int { namespace Extensional {
   }
 
 
+  /*
+   * Expansion of compressed tuple sets
+   *
+   */
+  template<class View>
+  TupleSet
+  expand(const ViewArray<View>& x, const TupleSet& ts) {
+    assert(ts.compressed() && (x.size() == ts.arity()));
+    int n = ts.arity();
+    TupleSet e(n);
+    Region r;
+    // Values for each position, their number, and the current value
+    int** v = r.alloc<int*>(n);
+    int* n_v = r.alloc<int>(n);
+    int* c = r.alloc<int>(n);
+    for (int a=0; a<n; a++)
+      v[a] = r.alloc<int>(x[a].size());
+    IntArgs t(n);
+    for (int i=0; i<ts.tuples(); i++) {
+      TupleSet::Tuple l = ts[i];
+      TupleSet::Tuple u = ts.upper(i);
+      // Collect values of the variables that are in the intervals
+      for (int a=0; a<n; a++) {
+        n_v[a] = 0; c[a] = 0;
+        for (ViewRanges<View> rx(x[a]); rx() && (rx.min() <= u[a]); ++rx)
+          for (int k=std::max(rx.min(),l[a]);
+               k<=std::min(rx.max(),u[a]); k++)
+            v[a][n_v[a]++] = k;
+        if (n_v[a] == 0)
+          goto next;
+      }
+      // Add all tuples of the Cartesian product
+      while (true) {
+        for (int a=0; a<n; a++)
+          t[a] = v[a][c[a]];
+        e.add(t);
+        int a=n-1;
+        while ((a >= 0) && (++c[a] == n_v[a]))
+          c[a--] = 0;
+        if (a < 0)
+          break;
+      }
+    next: ;
+    }
+    e.finalize();
+    return e;
+  }
+
+
   /*
    * Post function
    */
@@ -956,6 +1022,10 @@ namespace Gecode { namespace Int { namespace Extensional {
     if (ts.tuples() == 0)
       return ES_OK;
 
+    // The counting in the propagator requires ground tuples
+    if (ts.compressed())
+      return postnegcompact(home,x,expand(x,ts));
+
     // Check whether a variable does not overlap with supported values
     for (int i=0; i<x.size(); i++) {
       TupleSet::Ranges rs(ts,i);
@@ -1202,6 +1272,9 @@ namespace Gecode { namespace Int { namespace Extensional {
       }
       return ES_OK;
     }
+    // The entailment test in the propagator requires ground tuples
+    if (ts.compressed())
+      return postrecompact<View,CtrlView,rm>(home,x,expand(x,ts),b);
     // Check whether a variable does not overlap with supported values
     for (int i=0; i<x.size(); i++) {
       TupleSet::Ranges rs(ts,i);
@@ -237,6 +237,17 @@ namespace Gecode { namespace Int { namespace Extensional {
     assert(n > 0);
   }
 
+  template<class View, class Val, class Degree, class StateIdx>
+  template<class Var>
+  forceinline
+  LayeredGraph<View,Val,Degree,StateIdx>::LayeredGraph(Home home,
+                                                       const VarArgArray<Var>& x,
+                                                       const MDD& mdd)
+    : Propagator(home), c(home), n(x.size()),
+      max_states(static_cast<StateIdx>(mdd.max_width())) {
+    assert(n > 0);
+  }
+
   template<class View, class Val, class Degree, class StateIdx>
   forceinline void
   LayeredGraph<View,Val,Degree,StateIdx>::audit(void) {
@@ -319,6 +330,77 @@ namespace Gecode { namespace Int { namespace Extensional {
       if (o_state(n-1,static_cast<StateIdx>(s)).i_deg != 0)
         o_state(n-1,static_cast<StateIdx>(s)).o_deg = 1;
 
+    return complete(home);
+  }
+
+  template<class View, class Val, class Degree, class StateIdx>
+  template<class Var>
+  forceinline ExecStatus
+  LayeredGraph<View,Val,Degree,StateIdx>::initialize(Space& home,
+                                                     const VarArgArray<Var>& x,
+                                                     const MDD& mdd) {
+
+    Region r;
+
+    // Allocate memory for layers
+    layers = home.alloc<Layer>(n+1);
+
+    // Allocate temporary memory for all possible states
+    State* states = r.alloc<State>(max_states*(n+1));
+    for (int i=0; i<static_cast<int>(max_states)*(n+1); i++)
+      states[i].init();
+    for (int i=0; i<n+1; i++)
+      layers[i].states = states + i*max_states;
+
+    // Allocate temporary memory for edges
+    Edge* edges = r.alloc<Edge>(mdd.max_degree());
+
+    // Mark root as being reachable
+    i_state(0,0).i_deg = 1;
+
+    // Forward pass: add edges of the MDD
+    for (int i=0; i<n; i++) {
+      layers[i].x = x[i];
+      layers[i].support = home.alloc<Support>(layers[i].x.size());
+      ValSize j=0;
+      // Enter edges leaving reachable nodes (indegree != 0)
+      for (ViewValues<View> nx(layers[i].x); nx(); ++nx) {
+        Degree n_edges=0;
+        for (MDD::Edges e(mdd,i,nx.val()); e(); ++e)
+          if (i_state(i,static_cast<StateIdx>(e.i_node())).i_deg != 0) {
+            i_state(i,static_cast<StateIdx>(e.i_node())).o_deg++;
+            o_state(i,static_cast<StateIdx>(e.o_node())).i_deg++;
+            edges[n_edges].i_state = static_cast<StateIdx>(e.i_node());
+            edges[n_edges].o_state = static_cast<StateIdx>(e.o_node());
+            n_edges++;
+          }
+        assert(n_edges <= mdd.max_degree());
+        // Found support for value
+        if (n_edges > 0) {
+          Support& s = layers[i].support[j];
+          s.val = static_cast<Val>(nx.val());
+          s.n_edges = n_edges;
+          s.edges = Heap::copy(home.alloc<Edge>(n_edges),edges,n_edges);
+          j++;
+        }
+      }
+      if ((layers[i].size = j) == 0)
+        return ES_FAILED;
+    }
+
+    // Mark terminal as reachable
+    if (o_state(n-1,0).i_deg != 0)
+      o_state(n-1,0).o_deg = 1;
+
+    return complete(home);
+  }
+
+  template<class View, class Val, class Degree, class StateIdx>
+  forceinline ExecStatus
+  LayeredGraph<View,Val,Degree,StateIdx>::complete(Space& home) {
+
+    Region r;
+
     // Backward pass: prune all transitions that do not lead to final state
     for (int i=n; i--; ) {
       ValSize k=0;
@@ -699,6 +781,27 @@ namespace Gecode { namespace Int { namespace Extensional {
     return p->initialize(home,x,dfa);
   }
 
+  template<class View, class Val, class Degree, class StateIdx>
+  template<class Var>
+  ExecStatus
+  LayeredGraph<View,Val,Degree,StateIdx>::post(Home home,
+                                               const VarArgArray<Var>& x,
+                                               const MDD& mdd) {
+    assert(x.size() == mdd.arity());
+    if (mdd.empty())
+      return ES_FAILED;
+    if (x.size() == 0)
+      return ES_OK;
+    for (int i=0; i<x.size(); i++) {
+      MDD::Values v(mdd,i);
+      typename VarTraits<Var>::View xi(x[i]);
+      GECODE_ME_CHECK(xi.inter_v(home,v,false));
+    }
+    LayeredGraph<View,Val,Degree,StateIdx>* p =
+      new (home) LayeredGraph<View,Val,Degree,StateIdx>(home,x,mdd);
+    return p->initialize(home,x,mdd);
+  }
+
   template<class View, class Val, class Degree, class StateIdx>
   forceinline
   LayeredGraph<View,Val,Degree,StateIdx>
@@ -846,17 +949,12 @@ namespace Gecode { namespace Int { namespace Extensional {
     return new (home) LayeredGraph<View,Val,Degree,StateIdx>(home,*this);
   }
 
-  /// Select small types for the layered graph propagator
-  template<class Var>
-  forceinline ExecStatus
-  post_lgp(Home home, const VarArgArray<Var>& x, const DFA& dfa) {
-    Gecode::Support::IntType t_state_idx =
-      Gecode::Support::u_type(static_cast<unsigned int>(dfa.n_states()));
-    Gecode::Support::IntType t_degree =
-      Gecode::Support::u_type(dfa.max_degree());
-    Gecode::Support::IntType t_val =
-      std::max(Support::s_type(dfa.symbol_min()),
-               Support::s_type(dfa.symbol_max()));
+  template<class Var, class Graph>
+  ExecStatus
+  post_lgp(Home home, const VarArgArray<Var>& x, const Graph& g,
+           Gecode::Support::IntType t_val,
+           Gecode::Support::IntType t_state_idx,
+           Gecode::Support::IntType t_degree) {
     switch (t_val) {
     case Gecode::Support::IT_CHAR:
       // fall through
@@ -867,15 +965,15 @@ namespace Gecode { namespace Int { namespace Extensional {
         case Gecode::Support::IT_CHAR:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned char,unsigned char>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_SHRT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned short int,unsigned char>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_INT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned int,unsigned char>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         default: GECODE_NEVER;
         }
         break;
@@ -884,15 +982,15 @@ namespace Gecode { namespace Int { namespace Extensional {
         case Gecode::Support::IT_CHAR:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned char,unsigned short int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_SHRT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned short int,unsigned short int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_INT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned int,unsigned short int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         default: GECODE_NEVER;
         }
         break;
@@ -901,15 +999,15 @@ namespace Gecode { namespace Int { namespace Extensional {
         case Gecode::Support::IT_CHAR:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned char,unsigned int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_SHRT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned short int,unsigned int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_INT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned int,unsigned int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         default: GECODE_NEVER;
         }
         break;
@@ -923,15 +1021,15 @@ namespace Gecode { namespace Int { namespace Extensional {
         case Gecode::Support::IT_CHAR:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned char,unsigned char>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_SHRT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned short int,unsigned char>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_INT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned int,unsigned char>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         default: GECODE_NEVER;
         }
         break;
@@ -940,15 +1038,15 @@ namespace Gecode { namespace Int { namespace Extensional {
         case Gecode::Support::IT_CHAR:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned char,unsigned short int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_SHRT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned short int,unsigned short int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_INT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned int,unsigned short int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         default: GECODE_NEVER;
         }
         break;
@@ -957,15 +1055,15 @@ namespace Gecode { namespace Int { namespace Extensional {
         case Gecode::Support::IT_CHAR:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned char,unsigned int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_SHRT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned short int,unsigned int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_INT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned int,unsigned int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         default: GECODE_NEVER;
         }
         break;
@@ -977,6 +1075,34 @@ namespace Gecode { namespace Int { namespace Extensional {
     return ES_OK;
   }
 
+  /// Select small types for the layered graph propagator
+  template<class Var>
+  forceinline ExecStatus
+  post_lgp(Home home, const VarArgArray<Var>& x, const DFA& dfa) {
+    Gecode::Support::IntType t_state_idx =
+      Gecode::Support::u_type(static_cast<unsigned int>(dfa.n_states()));
+    Gecode::Support::IntType t_degree =
+      Gecode::Support::u_type(dfa.max_degree());
+    Gecode::Support::IntType t_val =
+      std::max(Support::s_type(dfa.symbol_min()),
+               Support::s_type(dfa.symbol_max()));
+    return post_lgp(home,x,dfa,t_val,t_state_idx,t_degree);
+  }
+
+  /// Select small types for the layered graph propagator
+  template<class Var>
+  forceinline ExecStatus
+  post_lgp(Home home, const VarArgArray<Var>& x, const MDD& mdd) {
+    Gecode::Support::IntType t_state_idx =
+      Gecode::Support::u_type(static_cast<unsigned int>(mdd.max_width()));
+    Gecode::Support::IntType t_degree =
+      Gecode::Support::u_type(mdd.max_degree());
+    Gecode::Support::IntType t_val =
+      std::max(Support::s_type(mdd.min()),
+               Support::s_type(mdd.max()));
+    return post_lgp(home,x,mdd,t_val,t_state_idx,t_degree);
+  }
+
 }}}
 
 // STATISTICS: int-prop
@@ -0,0 +1,339 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2020
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/int.hh>
+
+namespace Gecode { namespace Int { namespace Extensional {
+
+  /// Sort edges by node and value
+  class EdgeByNode {
+  public:
+    forceinline bool
+    operator ()(const MDD::Edge& x, const MDD::Edge& y) {
+      return (x.i_node < y.i_node) ||
+        ((x.i_node == y.i_node) && (x.val < y.val));
+    }
+  };
+
+  /// Sort edges by value and node
+  class EdgeByVal {
+  public:
+    forceinline bool
+    operator ()(const MDD::Edge& x, const MDD::Edge& y) {
+      return (x.val < y.val) ||
+        ((x.val == y.val) && (x.i_node < y.i_node));
+    }
+  };
+
+  /// Sort nodes by their outgoing edges
+  class NodeByEdges {
+  private:
+    /// The edges (sorted by node and value)
+    const MDD::Edge* e;
+    /// First edge for each node (and end of edges)
+    const int* fst;
+  public:
+    /// Initialize
+    NodeByEdges(const MDD::Edge* e0, const int* fst0)
+      : e(e0), fst(fst0) {}
+    /// Test whether the outgoing edges of \a x are smaller than of \a y
+    forceinline bool
+    operator ()(int x, int y) {
+      int i=fst[x], j=fst[y];
+      for ( ; (i<fst[x+1]) && (j<fst[y+1]); i++, j++)
+        if (e[i].val != e[j].val)
+          return e[i].val < e[j].val;
+        else if (e[i].o_node != e[j].o_node)
+          return e[i].o_node < e[j].o_node;
+      return (i == fst[x+1]) && (j < fst[y+1]);
+    }
+    /// Test whether \a x and \a y have the same outgoing edges
+    forceinline bool
+    same(int x, int y) {
+      if (fst[x+1]-fst[x] != fst[y+1]-fst[y])
+        return false;
+      for (int i=fst[x], j=fst[y]; i<fst[x+1]; i++, j++)
+        if ((e[i].val != e[j].val) || (e[i].o_node != e[j].o_node))
+          return false;
+      return true;
+    }
+  };
+
+}}}
+
+namespace Gecode {
+
+  void
+  MDD::init(int a, int w[], Edge* e[], int n[]) {
+    using namespace Int::Extensional;
+    Region r;
+
+    // Nodes on each layer that are reachable from the root
+    bool** f = r.alloc<bool*>(a+1);
+    for (int l=0; l<=a; l++) {
+      f[l] = r.alloc<bool>(w[l]);
+      for (int i=0; i<w[l]; i++)
+        f[l][i] = false;
+    }
+    if (w[0] > 0)
+      f[0][0] = true;
+    for (int l=0; l<a; l++)
+      for (int j=0; j<n[l]; j++)
+        if (f[l][e[l][j].i_node])
+          f[l+1][e[l][j].o_node] = true;
+
+    // Keep only edges on a path from the root to the terminal
+    bool** b = r.alloc<bool*>(a+1);
+    for (int l=0; l<=a; l++) {
+      b[l] = r.alloc<bool>(w[l]);
+      for (int i=0; i<w[l]; i++)
+        b[l][i] = false;
+    }
+    b[a][0] = f[a][0];
+    for (int l=a; l--; ) {
+      int k=0;
+      for (int j=0; j<n[l]; j++)
+        if (f[l][e[l][j].i_node] && b[l+1][e[l][j].o_node]) {
+          b[l][e[l][j].i_node] = true;
+          e[l][k++] = e[l][j];
+        }
+      n[l] = k;
+    }
+
+    // Merge nodes with the same outgoing edges, bottom-up
+    int** id = r.alloc<int*>(a+1);
+    id[a] = r.alloc<int>(1);
+    id[a][0] = 0;
+    w[a] = b[a][0] ? 1 : 0;
+    for (int l=a; l--; ) {
+      id[l] = r.alloc<int>(w[l]);
+      for (int j=0; j<n[l]; j++)
+        e[l][j].o_node = id[l+1][e[l][j].o_node];
+      EdgeByNode ebn;
+      Support::quicksort<Edge,EdgeByNode>(e[l],n[l],ebn);
+      // First edge for each node
+      int* fst = r.alloc<int>(w[l]+1);
+      for (int i=0; i<=w[l]; i++)
+        fst[i] = 0;
+      for (int j=0; j<n[l]; j++)
+        fst[e[l][j].i_node+1]++;
+      for (int i=0; i<w[l]; i++)
+        fst[i+1] += fst[i];
+      // Sort nodes with edges by their edges
+      int* nd = r.alloc<int>(w[l]);
+      int m=0;
+      for (int i=0; i<w[l]; i++)
+        if (fst[i] < fst[i+1])
+          nd[m++] = i;
+      NodeByEdges nbe(e[l],fst);
+      Support::quicksort<int,NodeByEdges>(nd,m,nbe);
+      // Number nodes and keep the edges of one node per number
+      Edge* ne = r.alloc<Edge>(n[l]);
+      int k=0, c=-1;
+      for (int i=0; i<m; i++) {
+        if ((i == 0) || !nbe.same(nd[i-1],nd[i])) {
+          c++;
+          for (int j=fst[nd[i]]; j<fst[nd[i]+1]; j++) {
+            ne[k] = e[l][j]; ne[k].i_node = c; k++;
+          }
+        }
+        id[l][nd[i]] = c;
+      }
+      e[l] = ne; n[l] = k; w[l] = c+1;
+    }
+
+    // Count edges and values
+    int n_e = 0, n_v = 0;
+    for (int l=0; l<a; l++) {
+      EdgeByVal ebv;
+      Support::quicksort<Edge,EdgeByVal>(e[l],n[l],ebv);
+      n_e += n[l];
+      for (int j=0; j<n[l]; j++)
+        if ((j == 0) || (e[l][j-1].val != e[l][j].val))
+          n_v++;
+    }
+
+    // Construct the diagram
+    MDDI* d = new MDDI(a,n_e,n_v);
+    {
+      int ie = 0, iv = 0;
+      for (int l=0; l<=a; l++) {
+        d->width[l] = w[l];
+        d->n_nodes += w[l];
+        d->max_width = std::max(d->max_width,w[l]);
+      }
+      unsigned int* o_deg = r.alloc<unsigned int>(d->max_width);
+      unsigned int* i_deg = r.alloc<unsigned int>(d->max_width);
+      for (int i=0; i<d->max_width; i++)
+        i_deg[i] = 0U;
+      d->key = static_cast<std::size_t>(a);
+      cmb_hash(d->key, n_e);
+      for (int l=0; l<a; l++) {
+        d->e_fst[l] = ie;
+        d->v_fst[l] = iv;
+        cmb_hash(d->key, w[l]);
+        for (int i=0; i<w[l]; i++)
+          o_deg[i] = 0U;
+        for (int j=0; j<n[l]; ) {
+          MDDI::ValueEntry& ve = d->values[iv++];
+          ve.val = e[l][j].val;
+          ve.fst = d->edges + ie;
+          int k=j;
+          for ( ; (j<n[l]) && (e[l][j].val == ve.val); j++) {
+            const Edge& ej = e[l][j];
+            d->edges[ie++] = ej;
+            o_deg[ej.i_node]++;
+            cmb_hash(d->key, ej.i_node);
+            cmb_hash(d->key, ej.val);
+            cmb_hash(d->key, ej.o_node);
+          }
+          ve.lst = d->edges + ie;
+          d->max_degree =
+            std::max(d->max_degree,static_cast<unsigned int>(j-k));
+        }
+        for (int i=0; i<w[l]; i++)
+          d->max_degree = std::max(d->max_degree,std::max(o_deg[i],i_deg[i]));
+        for (int i=0; i<w[l+1]; i++)
+          i_deg[i] = 0U;
+        for (int j=0; j<n[l]; j++)
+          i_deg[e[l][j].o_node]++;
+      }
+      for (int i=0; i<w[a]; i++)
+        d->max_degree = std::max(d->max_degree,i_deg[i]);
+      d->e_fst[a] = ie;
+      d->v_fst[a] = iv;
+      assert((ie == n_e) && (iv == n_v));
+    }
+    object(d);
+  }
+
+  MDD::MDD(const TupleSet& ts) {
+    if (!ts)
+      throw Int::UninitializedTupleSet("MDD::MDD");
+    if (!ts.finalized())
+      throw Int::NotYetFinalized("MDD::MDD");
+    if (ts.compressed())
+      throw Int::IllegalOperation("MDD::MDD");
+    int a = ts.arity();
+    int m = ts.tuples();
+    Region r;
+    // Build a trie: each node corresponds to a tuple prefix
+    int* w = r.alloc<int>(a+1);
+    Edge** e = r.alloc<Edge*>(a);
+    int* n = r.alloc<int>(a);
+    for (int l=0; l<a; l++) {
+      e[l] = r.alloc<Edge>(m);
+      n[l] = 0;
+      w[l] = 0;
+    }
+    w[0] = 1; w[a] = 1;
+    for (int t=0; t<m; t++) {
+      // Tuples are sorted, find first position that differs from previous
+      int p = 0;
+      if (t > 0)
+        while (ts[t][p] == ts[t-1][p])
+          p++;
+      for (int l=p; l<a; l++) {
+        int i = (l == 0) ? 0 : w[l]-1;
+        int o = (l+1 == a) ? 0 : w[l+1]++;
+        e[l][n[l]++] = Edge(i,ts[t][l],o);
+      }
+    }
+    init(a,w,e,n);
+  }
+
+  MDD::MDD(int a, const DFA& dfa) {
+    if (a < 0)
+      throw Int::OutOfLimits("MDD::MDD");
+    int s = dfa.n_states();
+    Region r;
+    // Unfold the DFA: each layer has a node for each state
+    int* w = r.alloc<int>(a+1);
+    Edge** e = r.alloc<Edge*>(a);
+    int* n = r.alloc<int>(a);
+    bool* reach = r.alloc<bool>(s);
+    bool* next = r.alloc<bool>(s);
+    for (int i=0; i<s; i++)
+      reach[i] = false;
+    reach[0] = true;
+    for (int l=0; l<a; l++) {
+      w[l] = s;
+      e[l] = r.alloc<Edge>(dfa.n_transitions());
+      n[l] = 0;
+      for (int i=0; i<s; i++)
+        next[i] = false;
+      for (DFA::Transitions t(dfa); t(); ++t)
+        if (reach[t.i_state()]) {
+          if (l+1 < a) {
+            next[t.o_state()] = true;
+            e[l][n[l]++] = Edge(t.i_state(),t.symbol(),t.o_state());
+          } else if ((dfa.final_fst() <= t.o_state()) &&
+                     (t.o_state() < dfa.final_lst())) {
+            e[l][n[l]++] = Edge(t.i_state(),t.symbol(),0);
+          }
+        }
+      std::swap(reach,next);
+    }
+    if (a == 0)
+      w[0] = ((dfa.final_fst() <= 0) && (0 < dfa.final_lst())) ? 1 : 0;
+    else
+      w[a] = 1;
+    init(a,w,e,n);
+  }
+
+  bool
+  MDD::operator ==(const MDD& m) const {
+    if (object() == m.object())
+      return true;
+    if ((arity() != m.arity()) || (n_edges() != m.n_edges()) ||
+        (hash() != m.hash()))
+      return false;
+    for (int l=0; l<=arity(); l++)
+      if (width(l) != m.width(l))
+        return false;
+    for (int l=0; l<arity(); l++) {
+      Edges me(*this,l), they(m,l);
+      while (me()) {
+        if ((me.i_node() != they.i_node()) || (me.val() != they.val()) ||
+            (me.o_node() != they.o_node()))
+          return false;
+        ++me; ++they;
+      }
+    }
+    return true;
+  }
+
+}
+
+// STATISTICS: int-prop
@@ -0,0 +1,297 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2020
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode {
+
+  /**
+   * \brief Data stored for an %MDD
+   *
+   */
+  class MDD::MDDI : public SharedHandle::Object {
+  public:
+    /// Arity
+    int arity;
+    /// Number of nodes per layer
+    int* width;
+    /// Total number of nodes
+    int n_nodes;
+    /// Total number of edges
+    int n_edges;
+    /// Maximal number of nodes per layer
+    int max_width;
+    /// Maximal degree (in-degree and out-degree of any node) and maximal number of edges per value and layer
+    unsigned int max_degree;
+    /// Hash key
+    std::size_t key;
+    /// The edges (sorted by layer, value, and node)
+    Edge* edges;
+    /// Start of edges for each layer (and end of edges)
+    int* e_fst;
+    /// Edges for a value
+    class ValueEntry {
+    public:
+      int val;         ///< Value
+      const Edge* fst; ///< First edge for the value
+      const Edge* lst; ///< Last edge for the value
+    };
+    /// Values for all layers (sorted by layer and value)
+    ValueEntry* values;
+    /// Start of values for each layer (and end of values)
+    int* v_fst;
+    /// Initialize for arity \a a, \a ne edges, and \a nv values
+    MDDI(int a, int ne, int nv);
+    /// Return edges for value \a v on layer \a l (or nullptr)
+    const ValueEntry* find(int l, int v) const;
+    /// Delete implementation
+    virtual ~MDDI(void);
+  };
+
+  forceinline
+  MDD::MDDI::MDDI(int a, int ne, int nv)
+    : arity(a), width(heap.alloc<int>(a+1)), n_nodes(0), n_edges(ne),
+      max_width(0), max_degree(0), key(0),
+      edges(heap.alloc<Edge>(ne)), e_fst(heap.alloc<int>(a+1)),
+      values(heap.alloc<ValueEntry>(nv)), v_fst(heap.alloc<int>(a+1)) {}
+
+  forceinline
+  MDD::MDDI::~MDDI(void) {
+    heap.rfree(width);
+    heap.rfree(edges);
+    heap.rfree(e_fst);
+    heap.rfree(values);
+    heap.rfree(v_fst);
+  }
+
+  forceinline const MDD::MDDI::ValueEntry*
+  MDD::MDDI::find(int l, int v) const {
+    // Binary search for the value
+    int lo = v_fst[l];
+    int hi = v_fst[l+1];
+    while (lo < hi) {
+      int m = lo + (hi-lo) / 2;
+      if (values[m].val < v)
+        lo = m+1;
+      else
+        hi = m;
+    }
+    return ((lo < v_fst[l+1]) && (values[lo].val == v)) ? &values[lo] : nullptr;
+  }
+
+
+  forceinline
+  MDD::MDD(void) {}
+
+  forceinline
+  MDD::MDD(const MDD& m)
+    : SharedHandle(m) {}
+
+  forceinline bool
+  MDD::operator !=(const MDD& m) const {
+    return !(*this == m);
+  }
+
+  forceinline int
+  MDD::arity(void) const {
+    const MDDI* m = static_cast<MDDI*>(object());
+    return (m == nullptr) ? 0 : m->arity;
+  }
+
+  forceinline int
+  MDD::width(int l) const {
+    const MDDI* m = static_cast<MDDI*>(object());
+    return (m == nullptr) ? 1 : m->width[l];
+  }
+
+  forceinline bool
+  MDD::empty(void) const {
+    return width(0) == 0;
+  }
+
+  forceinline int
+  MDD::max_width(void) const {
+    const MDDI* m = static_cast<MDDI*>(object());
+    return (m == nullptr) ? 1 : m->max_width;
+  }
+
+  forceinline int
+  MDD::n_nodes(void) const {
+    const MDDI* m = static_cast<MDDI*>(object());
+    return (m == nullptr) ? 1 : m->n_nodes;
+  }
+
+  forceinline int
+  MDD::n_edges(void) const {
+    const MDDI* m = static_cast<MDDI*>(object());
+    return (m == nullptr) ? 0 : m->n_edges;
+  }
+
+  forceinline unsigned int
+  MDD::max_degree(void) const {
+    const MDDI* m = static_cast<MDDI*>(object());
+    return (m == nullptr) ? 0 : m->max_degree;
+  }
+
+  forceinline int
+  MDD::min(void) const {
+    const MDDI* m = static_cast<MDDI*>(object());
+    int v = Int::Limits::max;
+    if (m != nullptr)
+      for (int l=0; l<m->arity; l++)
+        if (m->v_fst[l] < m->v_fst[l+1])
+          v = std::min(v,m->values[m->v_fst[l]].val);
+    return v;
+  }
+
+  forceinline int
+  MDD::max(void) const {
+    const MDDI* m = static_cast<MDDI*>(object());
+    int v = Int::Limits::min;
+    if (m != nullptr)
+      for (int l=0; l<m->arity; l++)
+        if (m->v_fst[l] < m->v_fst[l+1])
+          v = std::max(v,m->values[m->v_fst[l+1]-1].val);
+    return v;
+  }
+
+  forceinline std::size_t
+  MDD::hash(void) const {
+    const MDDI* m = static_cast<MDDI*>(object());
+    return (m != nullptr) ? m->key : 0;
+  }
+
+
+  /*
+   * Constructing edges
+   *
+   */
+
+  forceinline
+  MDD::Edge::Edge(void) {}
+
+  forceinline
+  MDD::Edge::Edge(int i_node0, int val0, int o_node0)
+    : i_node(i_node0), val(val0), o_node(o_node0) {}
+
+
+  /*
+   * Iterating over edges
+   *
+   */
+
+  forceinline
+  MDD::Edges::Edges(const MDD& m, int l) {
+    const MDDI* o = static_cast<MDDI*>(m.object());
+    if (o != nullptr) {
+      c_edge = o->edges + o->e_fst[l];
+      e_edge = o->edges + o->e_fst[l+1];
+    } else {
+      c_edge = e_edge = nullptr;
+    }
+  }
+
+  forceinline
+  MDD::Edges::Edges(const MDD& m, int l, int v) {
+    const MDDI* o = static_cast<MDDI*>(m.object());
+    const MDDI::ValueEntry* ve = (o != nullptr) ? o->find(l,v) : nullptr;
+    if (ve != nullptr) {
+      c_edge = ve->fst;
+      e_edge = ve->lst;
+    } else {
+      c_edge = e_edge = nullptr;
+    }
+  }
+
+  forceinline bool
+  MDD::Edges::operator ()(void) const {
+    return c_edge < e_edge;
+  }
+
+  forceinline void
+  MDD::Edges::operator ++(void) {
+    c_edge++;
+  }
+
+  forceinline int
+  MDD::Edges::i_node(void) const {
+    return c_edge->i_node;
+  }
+
+  forceinline int
+  MDD::Edges::val(void) const {
+    return c_edge->val;
+  }
+
+  forceinline int
+  MDD::Edges::o_node(void) const {
+    return c_edge->o_node;
+  }
+
+
+  /*
+   * Iterating over values
+   *
+   */
+
+  forceinline
+  MDD::Values::Values(const MDD& m, int l) {
+    const MDDI* o = static_cast<MDDI*>(m.object());
+    if (o != nullptr) {
+      c_edge = o->edges + o->e_fst[l];
+      e_edge = o->edges + o->e_fst[l+1];
+    } else {
+      c_edge = e_edge = nullptr;
+    }
+  }
+
+  forceinline bool
+  MDD::Values::operator ()(void) const {
+    return c_edge < e_edge;
+  }
+
+  forceinline void
+  MDD::Values::operator ++(void) {
+    int v = c_edge->val;
+    do {
+      c_edge++;
+    } while ((c_edge < e_edge) && (v == c_edge->val));
+  }
+
+  forceinline int
+  MDD::Values::val(void) const {
+    return c_edge->val;
+  }
+
+}
+
+// STATISTICS: int-prop
@@ -43,53 +43,273 @@ namespace Gecode { namespace Int { namespace Extensional {
   /// Import tuple type
   typedef ::Gecode::TupleSet::Tuple Tuple;
 
-  /// Tuple comparison
-  class TupleCompare {
+  /// Comparison of compressed tuples by lower and then upper bounds
+  class BoundsCompare {
   private:
     /// The arity of the tuples to compare
     int arity;
+    /// The lower bounds
+    const int* l;
+    /// The upper bounds
+    const int* u;
   public:
-    /// Initialize with arity \a a
-    TupleCompare(int a);
+    /// Initialize with arity \a a, lower bounds \a l, and upper bounds \a u
+    BoundsCompare(int a, const int* l, const int* u);
     /// Comparison of tuples \a a and \a b
     bool operator ()(const Tuple& a, const Tuple& b);
   };
 
-  /// Tuple comparison by position
-  class PosCompare {
-  private:
-    /// The position of the tuples to compare
-    int p;
-  public:
-    /// Initialize with position \a p
-    PosCompare(int p);
-    /// Comparison of tuples \a a and \a b
-    bool operator ()(const Tuple& a, const Tuple& b);
-  };
-
-
   forceinline
-  TupleCompare::TupleCompare(int a) : arity(a) {}
+  BoundsCompare::BoundsCompare(int a, const int* l0, const int* u0)
+    : arity(a), l(l0), u(u0) {}
 
   forceinline bool
-  TupleCompare::operator ()(const Tuple& a, const Tuple& b) {
+  BoundsCompare::operator ()(const Tuple& a, const Tuple& b) {
     for (int i=0; i<arity; i++)
       if (a[i] < b[i])
         return true;
       else if (a[i] > b[i])
         return false;
+    const int* ua = u + (a - l);
+    const int* ub = u + (b - l);
+    for (int i=0; i<arity; i++)
+      if (ua[i] < ub[i])
+        return true;
+      else if (ua[i] > ub[i])
+        return false;
     return false;
   }
 
 
+  /**
+   * \brief Sort \a n tuples of arity \a a stored as rows in \a td
+   *
+   * Returns the permutation of the tuple numbers in lexicographic
+   * order. The tuples are sorted by a least significant digit radix
+   * sort: each position, starting from the last, is sorted by a stable
+   * counting sort on 16-bit digits of the value. Only one pass is
+   * needed for positions with fewer than \f$2^{16}\f$ different values.
+   */
+  unsigned int*
+  rowsort(const int* td, int n, int a, Region& r) {
+    const unsigned int n_d = 1U << 16;
+    unsigned int* p = r.alloc<unsigned int>(n);
+    unsigned int* q = r.alloc<unsigned int>(n);
+    // Digits of the current pass
+    unsigned short int* d = r.alloc<unsigned short int>(n);
+    unsigned int* c = r.alloc<unsigned int>(n_d+1U);
+    for (int i=0; i<n; i++)
+      p[i] = static_cast<unsigned int>(i);
+    for (int j=a; j--; ) {
+      int min=td[j], max=td[j];
+      for (int i=1; i<n; i++) {
+        int v = td[static_cast<size_t>(i)*a+j];
+        min = std::min(min,v); max = std::max(max,v);
+      }
+      unsigned int w = static_cast<unsigned int>(max) -
+        static_cast<unsigned int>(min);
+      for (unsigned int s=0U; (s < 32U) && ((w >> s) != 0U); s += 16U) {
+        for (unsigned int k=0U; k<=n_d; k++)
+          c[k] = 0U;
+        for (int i=0; i<n; i++) {
+          unsigned int v = static_cast<unsigned int>
+            (td[static_cast<size_t>(p[i])*a+j]) -
+            static_cast<unsigned int>(min);
+          d[i] = static_cast<unsigned short int>((v >> s) & (n_d-1U));
+          c[d[i]+1U]++;
+        }
+        for (unsigned int k=1U; k<=n_d; k++)
+          c[k] += c[k-1U];
+        for (int i=0; i<n; i++)
+          q[c[d[i]]++] = p[i];
+        std::swap(p,q);
+      }
+    }
+    return p;
+  }
+
+
+  /// Values and their supports for a single position of a tuple set
+  class Position {
+  public:
+    /// Smallest value
+    int min;
+    /// Largest value
+    int max;
+    /// Number of values
+    unsigned int n_vals;
+    /// Number of ranges
+    unsigned int n_ranges;
+    /// Value number plus one for each value between min and max (if dense)
+    unsigned int* idx;
+    /// Sorted values (if not dense)
+    int* val;
+    /// Find values for position \a j of \a n tuples of arity \a a in \a td
+    void init(const int* td, int n, int a, int j);
+    /// Return number of value \a v
+    unsigned int number(int v) const;
+    /// Initialize ranges \a r and supports \a s with \a n_words words
+    void fill(const int* td, int n, int a, int j,
+              TupleSet::Range* r, Support::BitSetData* s,
+              unsigned int n_words) const;
+    /// Release memory
+    void dispose(void);
+  };
+
+  void
+  Position::init(const int* td, int n, int a, int j) {
+    min=td[j]; max=td[j];
+    for (int i=1; i<n; i++) {
+      int v = td[static_cast<size_t>(i)*a+j];
+      min = std::min(min,v); max = std::max(max,v);
+    }
+    unsigned int w = static_cast<unsigned int>(max) -
+      static_cast<unsigned int>(min);
+    n_vals = 0U; n_ranges = 0U;
+    if (w < std::max(static_cast<unsigned int>(n), 1U << 16)) {
+      // Mark values in a table for all values between min and max
+      val = nullptr;
+      idx = heap.alloc<unsigned int>(w+1U);
+      for (unsigned int k=0U; k<=w; k++)
+        idx[k] = 0U;
+      for (int i=0; i<n; i++)
+        idx[static_cast<unsigned int>(td[static_cast<size_t>(i)*a+j]) -
+            static_cast<unsigned int>(min)] = 1U;
+      for (unsigned int k=0U; k<=w; k++)
+        if (idx[k] != 0U) {
+          if ((k == 0U) || (idx[k-1U] == 0U))
+            n_ranges++;
+          idx[k] = ++n_vals;
+        }
+    } else {
+      // Sort the values
+      idx = nullptr;
+      val = heap.alloc<int>(n);
+      for (int i=0; i<n; i++)
+        val[i] = td[static_cast<size_t>(i)*a+j];
+      Support::quicksort(val, n);
+      for (int i=0; i<n; i++)
+        if ((n_vals == 0U) || (val[n_vals-1U] != val[i])) {
+          if ((n_vals == 0U) || (val[n_vals-1U]+1 != val[i]))
+            n_ranges++;
+          val[n_vals++] = val[i];
+        }
+    }
+  }
+
+  forceinline unsigned int
+  Position::number(int v) const {
+    if (idx != nullptr)
+      return idx[static_cast<unsigned int>(v) -
+                 static_cast<unsigned int>(min)] - 1U;
+    return static_cast<unsigned int>
+      (std::lower_bound(val, val+n_vals, v) - val);
+  }
+
+  void
+  Position::fill(const int* td, int n, int a, int j,
+                 TupleSet::Range* r, Support::BitSetData* s,
+                 unsigned int n_words) const {
+    for (unsigned int k=0U; k<n_vals*n_words; k++)
+      s[k].init();
+    // Create ranges
+    unsigned int m=0U;
+    unsigned int l=0U;
+    for (unsigned int k=0U; k<n_vals; k++) {
+      int v;
+      if (idx != nullptr) {
+        // Find next value in table
+        while (idx[l] == 0U)
+          l++;
+        v = min + static_cast<int>(l++);
+      } else {
+        v = val[k];
+      }
+      if ((m > 0U) && (r[m-1U].max+1 == v)) {
+        r[m-1U].max = v;
+      } else {
+        r[m].min = r[m].max = v;
+        r[m].s = s + n_words*k;
+        r[m].step = n_words;
+        m++;
+      }
+    }
+    assert(m == n_ranges);
+    // Set bits for tuples
+    for (int i=0; i<n; i++) {
+      unsigned int k = number(td[static_cast<size_t>(i)*a+j]);
+      unsigned int b = static_cast<unsigned int>(i);
+      s[n_words*k + b / Support::BitSetData::bpb]
+        .set(b % Support::BitSetData::bpb);
+    }
+  }
+
+  forceinline void
+  Position::dispose(void) {
+    heap.rfree(idx);
+    heap.rfree(val);
+  }
+
+
+  /// Process positions of a tuple set by a thread
+  template<class Job>
+  class PositionWorker : public Support::Runnable {
+  protected:
+    /// The job to be done for each position
+    Job& job;
+    /// First position
+    int fst;
+    /// Distance between positions
+    int step;
+    /// Number of positions
+    int n;
+    /// Event signalled when done
+    Support::Event& done;
+  public:
+    /// Initialize
+    PositionWorker(Job& j, int f, int s, int n, Support::Event& e);
+    /// Perform job
+    virtual void run(void);
+  };
+
+  template<class Job>
   forceinline
-  PosCompare::PosCompare(int p0) : p(p0) {}
+  PositionWorker<Job>::PositionWorker(Job& j, int f, int s, int n0,
+                                      Support::Event& e)
+    : job(j), fst(f), step(s), n(n0), done(e) {}
 
-  forceinline bool
-  PosCompare::operator ()(const Tuple& a, const Tuple& b) {
-    return a[p] < b[p];
+  template<class Job>
+  void
+  PositionWorker<Job>::run(void) {
+    for (int i=fst; i<n; i+=step)
+      job(i);
+    done.signal();
   }
 
+  /// Perform \a job for all \a n positions, in parallel if \a par is true
+  template<class Job>
+  void
+  positions(int n, bool par, Job job) {
+#ifdef GECODE_HAS_THREADS
+    int t = par ?
+      std::min(static_cast<int>(Support::Thread::npu()), n) : 1;
+    if (t > 1) {
+      Support::Event* e = heap.alloc<Support::Event>(t-1);
+      for (int i=1; i<t; i++)
+        Support::Thread::run(new PositionWorker<Job>(job,i,t,n,e[i-1]));
+      for (int i=0; i<n; i+=t)
+        job(i);
+      for (int i=1; i<t; i++)
+        e[i-1].wait();
+      heap.free<Support::Event>(e,t-1);
+      return;
+    }
+#else
+    (void) par;
+#endif
+    for (int i=0; i<n; i++)
+      job(i);
+  }
 
 }}}
 
@@ -110,23 +330,37 @@ namespace Gecode {
     if (n_tuples == 0) {
       heap.rfree(td);
       td=nullptr;
+      heap.rfree(ud);
+      ud=nullptr;
       return;
     }
 
-    // Compact and copy data
-    Region r;
-    // Set up tuple pointers
-    Tuple* tuple = r.alloc<Tuple>(n_tuples);
-    {
+    // Compressed tuples might all be ground
+    if (ud != nullptr) {
+      int i=0;
+      while ((i < n_tuples*arity) && (td[i] == ud[i]))
+        i++;
+      if (i == n_tuples*arity) {
+        heap.rfree(ud);
+        ud=nullptr;
+      }
+    }
+
+    if (ud != nullptr) {
+      // Compact and copy data
+      Region r;
+      // Set up tuple pointers
+      Tuple* tuple = r.alloc<Tuple>(n_tuples);
       for (int t=0; t<n_tuples; t++)
         tuple[t] = td + t*arity;
-      TupleCompare tc(arity);
-      Support::quicksort(tuple, n_tuples, tc);
+      BoundsCompare bc(arity,td,ud);
+      Support::quicksort(tuple, n_tuples, bc);
       // Remove duplicates
       int j=1;
       for (int t=1; t<n_tuples; t++) {
         for (int a=0; a<arity; a++)
-          if (tuple[t-1][a] != tuple[t][a])
+          if ((tuple[t-1][a] != tuple[t][a]) ||
+              (ud[tuple[t-1]-td+a] != ud[tuple[t]-td+a]))
             goto notsame;
         goto same;
       notsame: ;
@@ -140,108 +374,212 @@ namespace Gecode {
       cmb_hash(key, arity);
       // Copy into now possibly smaller area
       int* new_td = heap.alloc<int>(n_tuples*arity);
+      int* new_ud = heap.alloc<int>(n_tuples*arity);
       for (int t=0; t<n_tuples; t++) {
         for (int a=0; a<arity; a++) {
           new_td[t*arity+a] = tuple[t][a];
           cmb_hash(key,tuple[t][a]);
         }
-        tuple[t] = new_td + t*arity;
+        for (int a=0; a<arity; a++) {
+          new_ud[t*arity+a] = ud[tuple[t]-td+a];
+          cmb_hash(key,new_ud[t*arity+a]);
+        }
       }
       heap.rfree(td);
       td = new_td;
-    }
-    
-    // Only now compute how many tuples are needed!
-    n_words = BitSetData::data(static_cast<unsigned int>(n_tuples));
+      heap.rfree(ud);
+      ud = new_ud;
+      n_words = BitSetData::data(static_cast<unsigned int>(n_tuples));
+      compress();
+    } else {
+      Region r;
+      {
+        // Sort the tuples and copy them without duplicates
+        const unsigned int* p = rowsort(td, n_tuples, arity, r);
+        int* new_td = heap.alloc<int>(static_cast<size_t>(n_tuples)*arity);
+        int n = 0;
+        for (int i=0; i<n_tuples; i++) {
+          const int* t = td + static_cast<size_t>(p[i])*arity;
+          int* d = new_td + static_cast<size_t>(n)*arity;
+          if ((n == 0) || !std::equal(t, t+arity, d-arity)) {
+            std::copy(t, t+arity, d);
+            n++;
+          }
+        }
+        assert(n <= n_tuples);
+        n_tuples = n;
+        heap.rfree(td);
+        td = new_td;
+        r.free();
+      }
+      // Initialize hash key
+      key = static_cast<std::size_t>(n_tuples);
+      cmb_hash(key, arity);
+      for (size_t i=0; i<static_cast<size_t>(n_tuples)*arity; i++)
+        cmb_hash(key, td[i]);
+
+      // Only now compute how many tuples are needed!
+      n_words = BitSetData::data(static_cast<unsigned int>(n_tuples));
 
-    // Compute range information
-    {
       /*
-       * Pass one: compute how many values and ranges are needed
+       * Compute range information: the positions are independent,
+       * hence large tuple sets process them in parallel.
        */
-      // How many values
+      bool par = (static_cast<unsigned long long int>(n_tuples) * arity
+                  >= (1ULL << 20));
+      Position* ps = r.alloc<Position>(arity);
+      int n = n_tuples;
+      int a = arity;
+      const int* t = td;
+      auto find = [ps,t,n,a](int j) {
+        ps[j].init(t,n,a,j);
+      };
+      positions(arity, par, find);
+      // Allocate memory for ranges and supports
       unsigned int n_vals = 0U;
-      // How many ranges
       unsigned int n_ranges = 0U;
-      for (int a=0; a<arity; a++) {
-        // Sort tuple according to position
-        PosCompare pc(a);
-        Support::quicksort(tuple, n_tuples, pc);
-        // Scan values
-        {
-          int max=tuple[0][a];
-          n_vals++; n_ranges++;
-          for (int i=1; i<n_tuples; i++) {
-            assert(tuple[i-1][a] <= tuple[i][a]);
-            if (max+1 == tuple[i][a]) {
-              n_vals++;
-              max=tuple[i][a];
-            } else if (max+1 < tuple[i][a]) {
-              n_vals++; n_ranges++;
-              max=tuple[i][a];
-            } else {
-              assert(max == tuple[i][a]);
-            }
-          }
+      for (int j=0; j<arity; j++) {
+        n_vals += ps[j].n_vals;
+        n_ranges += ps[j].n_ranges;
+        min = std::min(min,ps[j].min);
+        max = std::max(max,ps[j].max);
+      }
+      range = heap.alloc<Range>(n_ranges);
+      support = heap.alloc<BitSetData>(n_words * n_vals);
+      BitSetData** s = r.alloc<BitSetData*>(arity);
+      {
+        Range* cr = range;
+        BitSetData* cs = support;
+        for (int j=0; j<arity; j++) {
+          vd[j].r = cr; vd[j].n = ps[j].n_ranges; s[j] = cs;
+          cr += ps[j].n_ranges; cs += n_words * ps[j].n_vals;
         }
+        assert(cr == range + n_ranges);
+        assert(cs == support + n_words * n_vals);
       }
-      /*
-       * Pass 2: allocate memory and fill data structures
-       */
-      // Allocate memory for ranges
-      Range* cr = range = heap.alloc<Range>(n_ranges);
-      // Allocate and initialize memory for supports
-      BitSetData* cs = support = heap.alloc<BitSetData>(n_words * n_vals);
-      for (unsigned int i=0; i<n_vals * n_words; i++)
-        cs[i].init();
-      for (int a=0; a<arity; a++) {
-        // Set range pointer
-        vd[a].r = cr;
-        // Sort tuple according to position
-        PosCompare pc(a);
-        Support::quicksort(tuple, n_tuples, pc);
-        // Update min and max
-        min = std::min(min,tuple[0][a]);
-        max = std::max(max,tuple[n_tuples-1][a]);
-        // Compress into non-overlapping ranges
-        {
-          unsigned int j=0U;
-          vd[a].r[0].max=vd[a].r[0].min=tuple[0][a];
-          for (int i=1; i<n_tuples; i++) {
-            assert(tuple[i-1][a] <= tuple[i][a]);
-            if (vd[a].r[j].max+1 == tuple[i][a]) {
-              vd[a].r[j].max=tuple[i][a];
-            } else if (vd[a].r[j].max+1 < tuple[i][a]) {
-              j++; vd[a].r[j].min=vd[a].r[j].max=tuple[i][a];
+      ValueData* v = vd;
+      unsigned int w = n_words;
+      auto fill = [ps,t,n,a,v,s,w](int j) {
+        ps[j].fill(t,n,a,j,v[j].r,s[j],w);
+      };
+      positions(arity, par, fill);
+      for (int j=0; j<arity; j++)
+        ps[j].dispose();
+    }
+    if ((min < Int::Limits::min) || (max > Int::Limits::max))
+      throw Int::OutOfLimits("TupleSet::finalize()");
+    assert(finalized());
+  }
+
+  void
+  TupleSet::Data::compress(void) {
+    assert(ud != nullptr);
+    /*
+     * The values for a position are split into elementary intervals
+     * at the bounds of the tuple entries: all values of an elementary
+     * interval are supported by the same tuples. Single values are
+     * compressed into ranges where each value has its own supports,
+     * wider intervals become ranges with shared supports. Hence the
+     * supports are computed without expanding the compressed tuples.
+     */
+    Region r;
+    // Sorted lower bounds and sorted upper bounds plus one
+    int* l = r.alloc<int>(n_tuples);
+    int* h = r.alloc<int>(n_tuples);
+    // Sorted bounds of elementary intervals
+    int* b = r.alloc<int>(2*n_tuples);
+    // Ranges for each position
+    Range** tr = r.alloc<Range*>(arity);
+    // How many ranges and supports
+    unsigned int n_ranges = 0U;
+    unsigned int n_supports = 0U;
+    for (int a=0; a<arity; a++) {
+      for (int i=0; i<n_tuples; i++) {
+        l[i] = td[i*arity+a];
+        if ((l[i] < Int::Limits::min) || (ud[i*arity+a] > Int::Limits::max))
+          throw Int::OutOfLimits("TupleSet::finalize()");
+        h[i] = ud[i*arity+a] + 1;
+      }
+      Support::quicksort(l, n_tuples);
+      Support::quicksort(h, n_tuples);
+      min = std::min(min,l[0]);
+      max = std::max(max,h[n_tuples-1]-1);
+      // Merge bounds
+      int n_b = 0;
+      {
+        int i=0, j=0;
+        while ((i < n_tuples) || (j < n_tuples)) {
+          int v = ((j == n_tuples) || ((i < n_tuples) && (l[i] <= h[j])))
+            ? l[i++] : h[j++];
+          if ((n_b == 0) || (b[n_b-1] != v))
+            b[n_b++] = v;
+        }
+      }
+      // Find covered elementary intervals
+      Range* cr = tr[a] = r.alloc<Range>(n_b);
+      unsigned int n = 0U;
+      {
+        int i=0, j=0, c=0;
+        for (int k=0; k+1<n_b; k++) {
+          while ((i < n_tuples) && (l[i] == b[k])) {
+            c++; i++;
+          }
+          while ((j < n_tuples) && (h[j] == b[k])) {
+            c--; j++;
+          }
+          if (c == 0)
+            continue;
+          if (b[k]+1 == b[k+1]) {
+            if ((n > 0U) && (cr[n-1U].step != 0U) &&
+                (cr[n-1U].max+1 == b[k])) {
+              cr[n-1U].max = b[k];
             } else {
-              assert(vd[a].r[j].max == tuple[i][a]);
+              cr[n].min = cr[n].max = b[k]; cr[n].step = n_words; n++;
             }
+          } else {
+            cr[n].min = b[k]; cr[n].max = b[k+1]-1; cr[n].step = 0U; n++;
           }
-          vd[a].n = j+1U;
-          cr += j+1U;
+          n_supports++;
         }
-        // Set support pointer and set bits
-        for (unsigned int i=0U; i<vd[a].n; i++) {
-          vd[a].r[i].s = cs;
-          cs += n_words * vd[a].r[i].width();
-        }
-        {
-          int j=0;
-          for (int i=0; i<n_tuples; i++) {
-            while (tuple[i][a] > vd[a].r[j].max)
-              j++;
-            set(const_cast<BitSetData*>
-                (vd[a].r[j].supports(n_words,tuple[i][a])),
-                tuple2idx(tuple[i]));
+      }
+      vd[a].n = n;
+      n_ranges += n;
+    }
+
+    // Allocate and initialize ranges and supports
+    Range* cr = range = heap.alloc<Range>(n_ranges);
+    BitSetData* cs = support = heap.alloc<BitSetData>(n_words * n_supports);
+    for (unsigned int i=0; i<n_supports * n_words; i++)
+      cs[i].init();
+    for (int a=0; a<arity; a++) {
+      vd[a].r = cr;
+      for (unsigned int i=0U; i<vd[a].n; i++) {
+        cr[i] = tr[a][i];
+        cr[i].s = cs;
+        cs += (cr[i].step == 0U) ? n_words : n_words * cr[i].width();
+      }
+      cr += vd[a].n;
+    }
+    assert(cs == support + n_words * n_supports);
+    assert(cr == range + n_ranges);
+
+    // Set bits for all values covered by the tuple entries
+    for (int a=0; a<arity; a++)
+      for (int i=0; i<n_tuples; i++) {
+        int lo = td[i*arity+a];
+        int hi = ud[i*arity+a];
+        for (unsigned int k=vd[a].start(lo);
+             (k < vd[a].n) && (vd[a].r[k].min <= hi); k++) {
+          const Range& ck = vd[a].r[k];
+          if (ck.step == 0U) {
+            set(ck.s, static_cast<unsigned int>(i));
+          } else {
+            for (int v=std::max(lo,ck.min); v<=std::min(hi,ck.max); v++)
+              set(const_cast<BitSetData*>(ck.supports(n_words,v)),
+                  static_cast<unsigned int>(i));
           }
         }
       }
-      assert(cs == support + n_words * n_vals);
-      assert(cr == range + n_ranges);
-    }
-    if ((min < Int::Limits::min) || (max > Int::Limits::max))
-      throw Int::OutOfLimits("TupleSet::finalize()");
-    assert(finalized());
   }
 
   void
@@ -249,11 +587,14 @@ namespace Gecode {
     assert(n_free == 0);
     int n = static_cast<int>(1+n_tuples*1.5);
     td = heap.realloc<int>(td, n_tuples * arity, n * arity);
+    if (ud != nullptr)
+      ud = heap.realloc<int>(ud, n_tuples * arity, n * arity);
     n_free = n - n_tuples;
   }
 
   TupleSet::Data::~Data(void) {
     heap.rfree(td);
+    heap.rfree(ud);
     heap.rfree(vd);
     heap.rfree(range);
     heap.rfree(support);
@@ -452,7 +793,7 @@ namespace Gecode {
     assert(max() == t.max());
     for (int i=0; i<tuples(); i++)
       for (int j=0; j<arity(); j++)
-        if ((*this)[i][j] != t[i][j])
+        if (((*this)[i][j] != t[i][j]) || (upper(i)[j] != t.upper(i)[j]))
           return false;
     return true;
   }
@@ -468,6 +809,36 @@ namespace Gecode {
     Tuple a = raw().add();
     for (int i=0; i<t.size(); i++)
       a[i]=t[i];
+    if (raw().ud != nullptr) {
+      Tuple b = raw().ud + (a - raw().td);
+      for (int i=0; i<t.size(); i++)
+        b[i]=t[i];
+    }
+  }
+
+  void
+  TupleSet::_add(const IntArgs& l, const IntArgs& u) {
+    if (!*this)
+      throw Int::UninitializedTupleSet("TupleSet::add()");
+    if (raw().finalized())
+      throw Int::AlreadyFinalized("TupleSet::add()");
+    if ((l.size() != raw().arity) || (u.size() != raw().arity))
+      throw Int::ArgumentSizeMismatch("TupleSet::add()");
+    // An empty interval means that the tuple is empty
+    for (int i=0; i<l.size(); i++)
+      if (l[i] > u[i])
+        return;
+    Data& d = raw();
+    if (d.ud == nullptr) {
+      // All tuples added so far are ground
+      d.ud = heap.alloc<int>((d.n_tuples + d.n_free) * d.arity);
+      Heap::copy(d.ud, d.td, d.n_tuples * d.arity);
+    }
+    Tuple a = d.add();
+    Tuple b = d.ud + (a - d.td);
+    for (int i=0; i<l.size(); i++) {
+      a[i]=l[i]; b[i]=u[i];
+    }
   }
 
 }
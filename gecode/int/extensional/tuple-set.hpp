@@ -49,7 +49,9 @@ namespace Gecode {
   forceinline const TupleSet::BitSetData*
   TupleSet::Range::supports(unsigned int n_words, int n) const {
     assert((min <= n) && (n <= max));
-    return s + n_words * static_cast<unsigned int>(n - min);
+    assert((step == 0U) || (step == n_words));
+    (void) n_words;
+    return s + step * static_cast<unsigned int>(n - min);
   }
 
   
@@ -62,7 +64,7 @@ namespace Gecode {
     : arity(a), n_words(0U), // To be initialized in finalize
       n_tuples(0), n_free(n_initial_free),
       min(Int::Limits::max), max(Int::Limits::min), key(0),
-      td(heap.alloc<int>(n_initial_free * a)),
+      td(heap.alloc<int>(n_initial_free * a)), ud(nullptr),
       vd(heap.alloc<ValueData>(a)),
       range(nullptr), support(nullptr) {
   }
@@ -143,6 +145,11 @@ namespace Gecode {
     _add(t); return *this;
   }
 
+  forceinline TupleSet&
+  TupleSet::add(const IntArgs& l, const IntArgs& u) {
+    _add(l,u); return *this;
+  }
+
   forceinline
   TupleSet::TupleSet(void) {}
 
@@ -201,6 +208,16 @@ namespace Gecode {
   TupleSet::operator [](int i) const {
     return data().get(i);
   }
+  forceinline TupleSet::Tuple
+  TupleSet::upper(int i) const {
+    Data& d = data();
+    Tuple t = d.get(i);
+    return (d.ud == nullptr) ? t : d.ud + (t - d.td);
+  }
+  forceinline bool
+  TupleSet::compressed(void) const {
+    return data().ud != nullptr;
+  }
   forceinline const TupleSet::Range*
   TupleSet::fst(int i) const {
     return data().fst(i);
@@ -220,6 +237,8 @@ namespace Gecode {
       return false;
     if (max() != t.max())
       return false;
+    if (compressed() != t.compressed())
+      return false;
     return equal(t);
   }
 
@@ -268,7 +287,10 @@ namespace Gecode {
   }
   forceinline void
   TupleSet::Ranges::operator ++(void) {
-    c++;
+    // Ranges of compressed tuple sets can be adjacent
+    do {
+      c++;
+    } while ((c<l) && (c->min == (c-1)->max+1));
   }
 
   forceinline int
@@ -277,11 +299,14 @@ namespace Gecode {
   }
   forceinline int
   TupleSet::Ranges::max(void) const {
-    return c->max;
+    const Range* d=c;
+    while ((d+1<l) && ((d+1)->min == d->max+1))
+      d++;
+    return d->max;
   }
   forceinline unsigned int
   TupleSet::Ranges::width(void) const {
-    return c->width();
+    return static_cast<unsigned int>(max() - min() + 1);
   }
 
 }
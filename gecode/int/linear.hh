@@ -767,9 +767,100 @@ namespace Gecode { namespace Int { namespace Linear {
     post(Home home, ViewArray<P>& x, ViewArray<N>& y, Val c, BoolView b);
   };
 
+  /**
+   * \brief %Propagator for incremental bounds consistent n-ary linear equality or less or equal
+   *
+   * Propagates \f$\sum_{i=0}^{|x|-1}x_i-\sum_{i=0}^{|y|-1}y_i = c\f$
+   * if \a eq is true and
+   * \f$\sum_{i=0}^{|x|-1}x_i-\sum_{i=0}^{|y|-1}y_i\leq c\f$ otherwise.
+   *
+   * Rather than recomputing the sums of the bounds of all views
+   * at each execution, the propagator uses advisors to maintain
+   * the sums of the lower and upper bounds incrementally. The
+   * propagator is only scheduled if a view might be pruned.
+   * The views are sorted by decreasing initial width of their
+   * domains, so that propagation stops at the first view whose
+   * initial width does not exceed the slack.
+   *
+   * The type \a Val can be either \c long long int or \c int, defining the
+   * numerical precision during propagation. The type \a View
+   * gives the type of the views.
+   *
+   * Requires \code #include <gecode/int/linear.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class Val, class View, bool eq>
+  class IncLin : public Propagator {
+  protected:
+    /// %Advisors for views (by position in view array)
+    class Index : public Advisor {
+    public:
+      /// Whether the view is in \a x (or in \a y)
+      bool p;
+      /// The position of the view in the view array
+      int i;
+      /// The lower bound of the view's contribution to the sum
+      Val l;
+      /// The upper bound of the view's contribution to the sum
+      Val u;
+      /// Create index advisor
+      Index(Space& home, Propagator& p, Council<Index>& c,
+            bool p0, int i, Val l, Val u);
+      /// Clone index advisor \a a
+      Index(Space& home, Index& a);
+    };
+    /// The advisor council
+    Council<Index> co;
+    /// Array of positive views
+    ViewArray<View> x;
+    /// Array of negative views
+    ViewArray<View> y;
+    /// Initial widths of the views in \a x (decreasing)
+    Val* wx;
+    /// Initial widths of the views in \a y (decreasing)
+    Val* wy;
+    /// Constant value
+    Val c;
+    /// Sum of the lower bounds of all views
+    Val l;
+    /// Sum of the upper bounds of all views
+    Val u;
+    /// Whether the propagator is currently running
+    bool run;
+    /// Number of already subsumed advisors (or views)
+    int n_subsumed;
+    /// Compact during cloning when more advisors than that are subsumed
+    static const int n_threshold = 7;
+    /// Test whether a view might be pruned
+    bool prunable(void) const;
+    /// Test whether the propagator is subsumed
+    bool subsumed(void) const;
+    /// Constructor for cloning \a p
+    IncLin(Space& home, IncLin& p);
+    /// Constructor for posting
+    IncLin(Home home, ViewArray<View>& x, ViewArray<View>& y, Val c);
+  public:
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home);
+    /// Cost function
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+    /// Post propagator for \f$\sum_{i=0}^{|x|-1}x_i-\sum_{i=0}^{|y|-1}y_i\sim c\f$
+    static ExecStatus
+    post(Home home, ViewArray<View>& x, ViewArray<View>& y, Val c);
+  };
+
 }}}
 
 #include <gecode/int/linear/int-nary.hpp>
+#include <gecode/int/linear/int-inc.hpp>
 #include <gecode/int/linear/int-dom.hpp>
 
 namespace Gecode { namespace Int { namespace Linear {
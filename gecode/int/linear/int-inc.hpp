@@ -0,0 +1,286 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Linear {
+
+  /*
+   * Incremental bounds consistent linear propagators
+   *
+   */
+
+  template<class Val, class View, bool eq>
+  forceinline
+  IncLin<Val,View,eq>::Index::Index(Space& home, Propagator& p,
+                                    Council<Index>& c,
+                                    bool p0, int i0, Val l0, Val u0)
+    : Advisor(home,p,c), p(p0), i(i0), l(l0), u(u0) {}
+
+  template<class Val, class View, bool eq>
+  forceinline
+  IncLin<Val,View,eq>::Index::Index(Space& home, Index& a)
+    : Advisor(home,a), p(a.p), i(a.i), l(a.l), u(a.u) {}
+
+
+  /// View with the initial width of its domain
+  template<class Val, class View>
+  class WidthView {
+  public:
+    /// The view
+    View x;
+    /// The width
+    Val w;
+  };
+
+  /// Sort views by decreasing width
+  template<class Val, class View>
+  class WidthGreater {
+  public:
+    /// Compare views \a a and \a b
+    bool operator ()(const WidthView<Val,View>& a,
+                     const WidthView<Val,View>& b) const {
+      return a.w > b.w;
+    }
+  };
+
+  /// Sort views in \a x by decreasing width and store widths in \a w
+  template<class Val, class View>
+  forceinline void
+  sortwidth(ViewArray<View>& x, Val* w) {
+    Region r;
+    WidthView<Val,View>* xw = r.alloc<WidthView<Val,View> >(x.size());
+    for (int i=0; i<x.size(); i++) {
+      xw[i].x = x[i];
+      xw[i].w = static_cast<Val>(x[i].max()) - static_cast<Val>(x[i].min());
+    }
+    WidthGreater<Val,View> wg;
+    Support::quicksort<WidthView<Val,View>,WidthGreater<Val,View> >
+      (xw,x.size(),wg);
+    for (int i=0; i<x.size(); i++) {
+      x[i] = xw[i].x; w[i] = xw[i].w;
+    }
+  }
+
+  template<class Val, class View, bool eq>
+  forceinline
+  IncLin<Val,View,eq>::IncLin(Home home,
+                              ViewArray<View>& x0, ViewArray<View>& y0,
+                              Val c0)
+    : Propagator(home), co(home), x(x0), y(y0), wx(nullptr), wy(nullptr),
+      c(c0), l(0), u(0), run(false), n_subsumed(0) {
+    if (x.size() > 0)
+      wx = static_cast<Space&>(home).alloc<Val>(x.size());
+    if (y.size() > 0)
+      wy = static_cast<Space&>(home).alloc<Val>(y.size());
+    sortwidth(x,wx);
+    sortwidth(y,wy);
+    for (int i=0; i<x.size(); i++) {
+      Val xl = x[i].min(), xu = x[i].max();
+      l += xl; u += xu;
+      if (x[i].assigned())
+        n_subsumed++;
+      else
+        x[i].subscribe(home, *new (home) Index(home,*this,co,true,i,xl,xu));
+    }
+    for (int i=0; i<y.size(); i++) {
+      Val yl = -y[i].max(), yu = -y[i].min();
+      l += yl; u += yu;
+      if (y[i].assigned())
+        n_subsumed++;
+      else
+        y[i].subscribe(home, *new (home) Index(home,*this,co,false,i,yl,yu));
+    }
+    View::schedule(home,*this,ME_INT_BND);
+  }
+
+  template<class Val, class View, bool eq>
+  ExecStatus
+  IncLin<Val,View,eq>::post(Home home,
+                            ViewArray<View>& x, ViewArray<View>& y, Val c) {
+    (void) new (home) IncLin<Val,View,eq>(home,x,y,c);
+    return ES_OK;
+  }
+
+  template<class Val, class View, bool eq>
+  forceinline
+  IncLin<Val,View,eq>::IncLin(Space& home, IncLin<Val,View,eq>& p)
+    : Propagator(home,p),
+      c(p.c), l(p.l), u(p.u), run(false), n_subsumed(p.n_subsumed) {
+    co.update(home,p.co);
+    x.update(home,p.x);
+    y.update(home,p.y);
+    wx = (x.size() > 0) ? home.alloc<Val>(x.size()) : nullptr;
+    for (int i=0; i<x.size(); i++)
+      wx[i] = p.wx[i];
+    wy = (y.size() > 0) ? home.alloc<Val>(y.size()) : nullptr;
+    for (int i=0; i<y.size(); i++)
+      wy[i] = p.wy[i];
+  }
+
+  template<class Val, class View, bool eq>
+  Actor*
+  IncLin<Val,View,eq>::copy(Space& home) {
+    if (n_subsumed > n_threshold) {
+      Region r;
+      // Record for which views there is an advisor
+      Support::BitSet<Region> ax(r,static_cast<unsigned int>(x.size()));
+      Support::BitSet<Region> ay(r,static_cast<unsigned int>(y.size()));
+      for (Advisors<Index> as(co); as(); ++as)
+        if (as.advisor().p)
+          ax.set(static_cast<unsigned int>(as.advisor().i));
+        else
+          ay.set(static_cast<unsigned int>(as.advisor().i));
+      // Compact view arrays (keeping the order) and compute map for advisors
+      int* mx = r.alloc<int>(x.size());
+      int j=0;
+      for (int i=0; i<x.size(); i++)
+        if (ax.get(static_cast<unsigned int>(i))) {
+          mx[i] = j; wx[j] = wx[i]; x[j++] = x[i];
+        }
+      x.size(j);
+      int* my = r.alloc<int>(y.size());
+      j=0;
+      for (int i=0; i<y.size(); i++)
+        if (ay.get(static_cast<unsigned int>(i))) {
+          my[i] = j; wy[j] = wy[i]; y[j++] = y[i];
+        }
+      y.size(j);
+      // Remap advisors
+      for (Advisors<Index> as(co); as(); ++as)
+        as.advisor().i = as.advisor().p ?
+          mx[as.advisor().i] : my[as.advisor().i];
+      n_subsumed = 0;
+    }
+    return new (home) IncLin<Val,View,eq>(home,*this);
+  }
+
+  template<class Val, class View, bool eq>
+  PropCost
+  IncLin<Val,View,eq>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::LO, x.size()+y.size());
+  }
+
+  template<class Val, class View, bool eq>
+  void
+  IncLin<Val,View,eq>::reschedule(Space& home) {
+    View::schedule(home,*this,ME_INT_BND);
+  }
+
+  template<class Val, class View, bool eq>
+  forceinline size_t
+  IncLin<Val,View,eq>::dispose(Space& home) {
+    for (Advisors<Index> as(co); as(); ++as)
+      if (as.advisor().p)
+        x[as.advisor().i].cancel(home,as.advisor());
+      else
+        y[as.advisor().i].cancel(home,as.advisor());
+    co.dispose(home);
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class Val, class View, bool eq>
+  forceinline bool
+  IncLin<Val,View,eq>::prunable(void) const {
+    // Slack of the upper and the lower bound
+    Val s = eq ? std::min(c - l, u - c) : c - l;
+    return (((x.size() > 0) && (wx[0] > s)) ||
+            ((y.size() > 0) && (wy[0] > s)));
+  }
+
+  template<class Val, class View, bool eq>
+  forceinline bool
+  IncLin<Val,View,eq>::subsumed(void) const {
+    return eq ? (l == u) : (u <= c);
+  }
+
+  template<class Val, class View, bool eq>
+  ExecStatus
+  IncLin<Val,View,eq>::advise(Space& home, Advisor& _a, const Delta&) {
+    Index& a = static_cast<Index&>(_a);
+    Val al, au;
+    bool assigned;
+    if (a.p) {
+      al = x[a.i].min(); au = x[a.i].max(); assigned = x[a.i].assigned();
+    } else {
+      al = -y[a.i].max(); au = -y[a.i].min(); assigned = y[a.i].assigned();
+    }
+    l += al - a.l; u += au - a.u;
+    a.l = al; a.u = au;
+    if (assigned) {
+      a.dispose(home,co);
+      n_subsumed++;
+    }
+    if (run)
+      return ES_FIX;
+    if ((l > c) || (eq && (u < c)))
+      return ES_FAILED;
+    return (prunable() || subsumed()) ? ES_NOFIX : ES_FIX;
+  }
+
+  template<class Val, class View, bool eq>
+  ExecStatus
+  IncLin<Val,View,eq>::propagate(Space& home, const ModEventDelta&) {
+    run = true;
+    Val ol, ou;
+    do {
+      ol = l; ou = u;
+      // Slack of the upper and the lower bound
+      Val sl = c - l;
+      Val su = u - c;
+      if ((sl < 0) || (eq && (su < 0)))
+        return ES_FAILED;
+      Val s = eq ? std::min(sl,su) : sl;
+      // Only views with an initial width larger than the slack can be pruned
+      for (int i=0; (i<x.size()) && (wx[i] > s); i++)
+        if (!x[i].assigned()) {
+          GECODE_ME_CHECK(x[i].lq(home,x[i].min() + sl));
+          if (eq)
+            GECODE_ME_CHECK(x[i].gq(home,x[i].max() - su));
+        }
+      for (int i=0; (i<y.size()) && (wy[i] > s); i++)
+        if (!y[i].assigned()) {
+          GECODE_ME_CHECK(y[i].gq(home,y[i].max() - sl));
+          if (eq)
+            GECODE_ME_CHECK(y[i].lq(home,y[i].min() + su));
+        }
+      // Pruning for less or equal does not change the lower bound
+    } while (eq && ((l != ol) || (u != ou)));
+    run = false;
+    return subsumed() ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -281,6 +281,149 @@ namespace Gecode { namespace Set { namespace RelOp {
                             const IntSet& z,View1 x);
   };
 
+
+  /**
+   * \brief Bitmap for a bound of a set over a small universe
+   *
+   * The universe consists of the values \f$b,\dots,b+255\f$ for some
+   * base \f$b\f$ which is maintained by the user of the bitmap.
+   * Value \f$b+i\f$ is represented by bit \f$i\f$.
+   *
+   */
+  class SmallBnd {
+  public:
+    /// Number of bits (and hence size of the universe)
+    static const unsigned int n_bits = 256U;
+    /// Number of words
+    static const unsigned int n_words = n_bits / Support::BitSetData::bpb;
+  protected:
+    /// The words
+    Support::BitSetData w[n_words];
+  public:
+    /// Initialize as empty
+    void init(void);
+    /// Initialize from range iterator \a i with base \a b
+    template<class I>
+    void init(I& i, int b);
+    /// Include bits \a l to \a u
+    void include(unsigned int l, unsigned int u);
+    /// Return number of bits set
+    unsigned int size(void) const;
+    /// Test whether no bits are set
+    bool none(void) const;
+    /// Return next bit at or after \a i with value \a s (or n_bits)
+    unsigned int next(unsigned int i, bool s) const;
+    /// Test whether bitmaps are equal
+    bool operator ==(const SmallBnd& y) const;
+    /// Test whether bitmaps are different
+    bool operator !=(const SmallBnd& y) const;
+    /// Test whether all bits are also set in \a y
+    bool subset(const SmallBnd& y) const;
+    /// Return union of \a x and \a y
+    static SmallBnd o(const SmallBnd& x, const SmallBnd& y);
+    /// Return intersection of \a x and \a y
+    static SmallBnd a(const SmallBnd& x, const SmallBnd& y);
+    /// Return difference of \a x and \a y
+    static SmallBnd d(const SmallBnd& x, const SmallBnd& y);
+    /// Update to union with \a y and return whether bits changed
+    bool o(const SmallBnd& y);
+    /// Update to intersection with \a y and return whether bits changed
+    bool a(const SmallBnd& y);
+    /// Update to difference with \a y and return whether bits changed
+    bool d(const SmallBnd& y);
+  };
+
+  /// Range iterator for small universe bitmaps
+  class SmallBndRanges {
+  protected:
+    /// The bitmap
+    const SmallBnd& s;
+    /// The base
+    int b;
+    /// First bit of current range
+    unsigned int l;
+    /// Last bit of current range
+    unsigned int u;
+  public:
+    /// \name Constructors and initialization
+    //@{
+    /// Initialize with bitmap \a s and base \a b
+    SmallBndRanges(const SmallBnd& s, int b);
+    //@}
+
+    /// \name Iteration control
+    //@{
+    /// Test whether iterator is still at a range or done
+    bool operator ()(void) const;
+    /// Move iterator to next range (if possible)
+    void operator ++(void);
+    //@}
+
+    /// \name Range access
+    //@{
+    /// Return smallest value of range
+    int min(void) const;
+    /// Return largest value of range
+    int max(void) const;
+    /// Return width of range (distance between minimum and maximum)
+    unsigned int width(void) const;
+    //@}
+  };
+
+  /// Bounds and cardinality of a set view over a small universe
+  class SmallView {
+  public:
+    /// Greatest lower bound
+    SmallBnd glb;
+    /// Least upper bound
+    SmallBnd lub;
+    /// Minimal cardinality
+    long long int cmin;
+    /// Maximal cardinality
+    long long int cmax;
+    /// Initialize from view \a x with base \a b
+    void init(SetView x, int b);
+    /// Make bounds and cardinality consistent, set \a mod if changed
+    ExecStatus normalize(bool& mod);
+    /// Tell bounds and cardinality to view \a x with base \a b
+    ExecStatus tell(Space& home, SetView x, int b) const;
+  };
+
+  /**
+   * \brief %Propagator for ternary set operations over a small universe
+   *
+   * Implements \f$z=x \diamond_{\mathit{op}} y\f$ where the least upper
+   * bounds of all views lie within a universe of at most 256 values.
+   * The bounds are propagated word-parallel on bitmaps and the
+   * cardinality reasoning uses the bitmap sizes.
+   *
+   * Requires \code #include <gecode/set/rel-op.hh> \endcode
+   * \ingroup FuncSetProp
+   */
+  template<SetOpType op>
+  class SmallTernary : public TernaryPropagator<SetView,PC_SET_ANY> {
+  protected:
+    using TernaryPropagator<SetView,PC_SET_ANY>::x0;
+    using TernaryPropagator<SetView,PC_SET_ANY>::x1;
+    using TernaryPropagator<SetView,PC_SET_ANY>::x2;
+    /// The base of the universe
+    int b;
+    /// Perform one round of propagation, set \a mod if changed
+    static void round(SmallView& x, SmallView& y, SmallView& z, bool& mod);
+    /// Constructor for cloning \a p
+    SmallTernary(Space& home, SmallTernary& p);
+    /// Constructor for posting
+    SmallTernary(Home home, SetView x, SetView y, SetView z, int b);
+  public:
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator \f$ z=x \diamond_{\mathit{op}} y\f$ with base \a b
+    static  ExecStatus post(Home home, SetView x, SetView y, SetView z,
+                            int b);
+  };
+
 }}}
 
 #include <gecode/set/rel-op/common.hpp>
@@ -289,6 +432,7 @@ namespace Gecode { namespace Set { namespace RelOp {
 #include <gecode/set/rel-op/inter.hpp>
 #include <gecode/set/rel-op/union.hpp>
 #include <gecode/set/rel-op/partition.hpp>
+#include <gecode/set/rel-op/small.hpp>
 #include <gecode/set/rel-op/post.hpp>
 
 #endif
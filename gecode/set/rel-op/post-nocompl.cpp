@@ -42,6 +42,12 @@ namespace Gecode { namespace Set { namespace RelOp {
   void
   post_nocompl(Home home, SetView x, SetOpType op, SetView y,
                SetRelType r, SetView z) {
+    int b;
+    if ((r == SRT_EQ) && small(x,y,z,b)) {
+      if (home.failed()) return;
+      rel_eq_small(home, x, op, y, z, b);
+      return;
+    }
     rel_op_post_nocompl<SetView,SetView,SetView>(home, x, op, y, r, z);
   }
 
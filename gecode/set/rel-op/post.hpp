@@ -76,6 +76,25 @@ namespace Gecode { namespace Set { namespace RelOp {
     }
   }
 
+  forceinline void
+  rel_eq_small(Home home, SetView x0, SetOpType op, SetView x1, SetView x2,
+               int b) {
+    switch(op) {
+    case SOT_DUNION:
+      GECODE_ES_FAIL(SmallTernary<SOT_DUNION>::post(home,x0,x1,x2,b));
+      break;
+    case SOT_UNION:
+      GECODE_ES_FAIL(SmallTernary<SOT_UNION>::post(home,x0,x1,x2,b));
+      break;
+    case SOT_INTER:
+      GECODE_ES_FAIL(SmallTernary<SOT_INTER>::post(home,x0,x1,x2,b));
+      break;
+    case SOT_MINUS:
+      GECODE_ES_FAIL(SmallTernary<SOT_MINUS>::post(home,x0,x1,x2,b));
+      break;
+    }
+  }
+
   template<class View0, class View1, class View2>
   forceinline void
   rel_sub(Home home, View0 x0, SetOpType op, View1 x1, View2 x2) {
@@ -0,0 +1,424 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Set { namespace RelOp {
+
+  /*
+   * Bitmaps for small universes
+   *
+   */
+
+  forceinline void
+  SmallBnd::init(void) {
+    for (unsigned int i=0U; i<n_words; i++)
+      w[i].init(false);
+  }
+  forceinline void
+  SmallBnd::include(unsigned int l, unsigned int u) {
+    assert((l <= u) && (u < n_bits));
+    const unsigned int bpb = Support::BitSetData::bpb;
+    for (unsigned int k=l / bpb; k<=u / bpb; k++) {
+      unsigned int lo = (l > k*bpb) ? l - k*bpb : 0U;
+      unsigned int hi = std::min(u - k*bpb, bpb - 1U);
+      // Mask with bits lo to hi set
+      Support::BitSetData m; m.init(true);
+      if (hi + 1U < bpb)
+        m.a(m,hi + 1U);
+      Support::BitSetData n; n.init(true);
+      n.a(n,lo);
+      w[k].o(Support::BitSetData::a(m,~n));
+    }
+  }
+  template<class I>
+  forceinline void
+  SmallBnd::init(I& i, int b) {
+    init();
+    for (; i(); ++i)
+      include(static_cast<unsigned int>(i.min()-b),
+              static_cast<unsigned int>(i.max()-b));
+  }
+  forceinline unsigned int
+  SmallBnd::size(void) const {
+    unsigned int s = 0U;
+    for (unsigned int i=0U; i<n_words; i++)
+      s += w[i].ones();
+    return s;
+  }
+  forceinline bool
+  SmallBnd::none(void) const {
+    for (unsigned int i=0U; i<n_words; i++)
+      if (!w[i].none())
+        return false;
+    return true;
+  }
+  forceinline unsigned int
+  SmallBnd::next(unsigned int i, bool s) const {
+    const unsigned int bpb = Support::BitSetData::bpb;
+    for (unsigned int k=i / bpb; k<n_words; k++) {
+      Support::BitSetData d = s ? w[k] : ~w[k];
+      unsigned int j = (k == i / bpb) ? i % bpb : 0U;
+      if (d(j))
+        return k*bpb + d.next(j);
+    }
+    return n_bits;
+  }
+  forceinline bool
+  SmallBnd::operator ==(const SmallBnd& y) const {
+    for (unsigned int i=0U; i<n_words; i++)
+      if (w[i] != y.w[i])
+        return false;
+    return true;
+  }
+  forceinline bool
+  SmallBnd::operator !=(const SmallBnd& y) const {
+    return !(*this == y);
+  }
+  forceinline bool
+  SmallBnd::subset(const SmallBnd& y) const {
+    for (unsigned int i=0U; i<n_words; i++)
+      if (!Support::BitSetData::a(w[i],~y.w[i]).none())
+        return false;
+    return true;
+  }
+  forceinline SmallBnd
+  SmallBnd::o(const SmallBnd& x, const SmallBnd& y) {
+    SmallBnd z;
+    for (unsigned int i=0U; i<n_words; i++)
+      z.w[i] = Support::BitSetData::o(x.w[i],y.w[i]);
+    return z;
+  }
+  forceinline SmallBnd
+  SmallBnd::a(const SmallBnd& x, const SmallBnd& y) {
+    SmallBnd z;
+    for (unsigned int i=0U; i<n_words; i++)
+      z.w[i] = Support::BitSetData::a(x.w[i],y.w[i]);
+    return z;
+  }
+  forceinline SmallBnd
+  SmallBnd::d(const SmallBnd& x, const SmallBnd& y) {
+    SmallBnd z;
+    for (unsigned int i=0U; i<n_words; i++)
+      z.w[i] = Support::BitSetData::a(x.w[i],~y.w[i]);
+    return z;
+  }
+  forceinline bool
+  SmallBnd::o(const SmallBnd& y) {
+    bool mod = false;
+    for (unsigned int i=0U; i<n_words; i++) {
+      Support::BitSetData z = Support::BitSetData::o(w[i],y.w[i]);
+      mod |= (z != w[i]); w[i] = z;
+    }
+    return mod;
+  }
+  forceinline bool
+  SmallBnd::a(const SmallBnd& y) {
+    bool mod = false;
+    for (unsigned int i=0U; i<n_words; i++) {
+      Support::BitSetData z = Support::BitSetData::a(w[i],y.w[i]);
+      mod |= (z != w[i]); w[i] = z;
+    }
+    return mod;
+  }
+  forceinline bool
+  SmallBnd::d(const SmallBnd& y) {
+    bool mod = false;
+    for (unsigned int i=0U; i<n_words; i++) {
+      Support::BitSetData z = Support::BitSetData::a(w[i],~y.w[i]);
+      mod |= (z != w[i]); w[i] = z;
+    }
+    return mod;
+  }
+
+
+  /*
+   * Range iterator for bitmaps
+   *
+   */
+
+  forceinline
+  SmallBndRanges::SmallBndRanges(const SmallBnd& s0, int b0)
+    : s(s0), b(b0), l(s.next(0U,true)) {
+    if (l < SmallBnd::n_bits)
+      u = s.next(l,false) - 1U;
+  }
+  forceinline bool
+  SmallBndRanges::operator ()(void) const {
+    return l < SmallBnd::n_bits;
+  }
+  forceinline void
+  SmallBndRanges::operator ++(void) {
+    l = s.next(u+1U,true);
+    if (l < SmallBnd::n_bits)
+      u = s.next(l,false) - 1U;
+  }
+  forceinline int
+  SmallBndRanges::min(void) const {
+    return b + static_cast<int>(l);
+  }
+  forceinline int
+  SmallBndRanges::max(void) const {
+    return b + static_cast<int>(u);
+  }
+  forceinline unsigned int
+  SmallBndRanges::width(void) const {
+    return u - l + 1U;
+  }
+
+
+  /*
+   * Views over small universes
+   *
+   */
+
+  forceinline void
+  SmallView::init(SetView x, int b) {
+    GlbRanges<SetView> g(x);
+    glb.init(g,b);
+    LubRanges<SetView> l(x);
+    lub.init(l,b);
+    cmin = x.cardMin(); cmax = x.cardMax();
+  }
+  forceinline ExecStatus
+  SmallView::normalize(bool& mod) {
+    if (!glb.subset(lub))
+      return ES_FAILED;
+    long long int g = glb.size();
+    long long int l = lub.size();
+    if (g > cmin) {
+      cmin = g; mod = true;
+    }
+    if (l < cmax) {
+      cmax = l; mod = true;
+    }
+    if (cmin > cmax)
+      return ES_FAILED;
+    if (g == cmax) {
+      if (lub != glb) {
+        lub = glb; mod = true;
+      }
+    } else if (l == cmin) {
+      glb = lub; mod = true;
+    }
+    return ES_OK;
+  }
+  forceinline ExecStatus
+  SmallView::tell(Space& home, SetView x, int b) const {
+    if (glb.size() > x.glbSize()) {
+      SmallBndRanges r(glb,b);
+      GECODE_ME_CHECK(x.includeI(home,r));
+    }
+    if (lub.size() < x.lubSize()) {
+      SmallBndRanges r(lub,b);
+      GECODE_ME_CHECK(x.intersectI(home,r));
+    }
+    GECODE_ME_CHECK(x.cardMin(home,static_cast<unsigned int>(cmin)));
+    GECODE_ME_CHECK(x.cardMax(home,static_cast<unsigned int>(cmax)));
+    return ES_OK;
+  }
+
+  /// Update \a c to be at least \a n, set \a mod if changed
+  forceinline void
+  gq(long long int& c, long long int n, bool& mod) {
+    if (n > c) {
+      c = n; mod = true;
+    }
+  }
+  /// Update \a c to be at most \a n, set \a mod if changed
+  forceinline void
+  lq(long long int& c, long long int n, bool& mod) {
+    if (n < c) {
+      c = n; mod = true;
+    }
+  }
+
+  /**
+   * \brief Test whether the lubs of \a x, \a y, and \a z fit a small universe
+   *
+   * If they do, the base of the universe is returned in \a b.
+   */
+  forceinline bool
+  small(SetView x, SetView y, SetView z, int& b) {
+    long long int l = Limits::max;
+    long long int u = Limits::min;
+    SetView v[3] = {x,y,z};
+    for (int i=0; i<3; i++)
+      if (v[i].lubSize() > 0U) {
+        l = std::min(l,static_cast<long long int>(v[i].lubMin()));
+        u = std::max(u,static_cast<long long int>(v[i].lubMax()));
+      }
+    if (l > u) {
+      b = 0; return true;
+    }
+    b = static_cast<int>(l);
+    return u - l < static_cast<long long int>(SmallBnd::n_bits);
+  }
+
+
+  /*
+   * Ternary operations over small universes
+   *
+   */
+
+  template<SetOpType op>
+  forceinline void
+  SmallTernary<op>::round(SmallView& x, SmallView& y, SmallView& z,
+                          bool& mod) {
+    switch (op) {
+    case SOT_INTER:
+      // z = x \cap y
+      mod |= z.glb.o(SmallBnd::a(x.glb,y.glb));
+      mod |= x.glb.o(z.glb);
+      mod |= y.glb.o(z.glb);
+      mod |= z.lub.a(SmallBnd::a(x.lub,y.lub));
+      mod |= x.lub.d(SmallBnd::d(y.glb,z.lub));
+      mod |= y.lub.d(SmallBnd::d(x.glb,z.lub));
+      {
+        long long int u = SmallBnd::o(x.lub,y.lub).size();
+        long long int g = SmallBnd::o(x.glb,y.glb).size();
+        // |z| = |x| + |y| - |x \cup y|
+        gq(z.cmin, x.cmin + y.cmin - u, mod);
+        lq(z.cmax, x.cmax + y.cmax - g, mod);
+        lq(z.cmax, std::min(x.cmax,y.cmax), mod);
+        gq(x.cmin, z.cmin, mod);
+        gq(y.cmin, z.cmin, mod);
+        lq(x.cmax, z.cmax + u - y.cmin, mod);
+        lq(y.cmax, z.cmax + u - x.cmin, mod);
+      }
+      break;
+    case SOT_DUNION:
+      // z = x \uplus y
+      mod |= x.lub.d(y.glb);
+      mod |= y.lub.d(x.glb);
+      gq(z.cmin, x.cmin + y.cmin, mod);
+      lq(x.cmax, z.cmax - y.cmin, mod);
+      lq(y.cmax, z.cmax - x.cmin, mod);
+      // fall through
+    case SOT_UNION:
+      // z = x \cup y
+      mod |= z.glb.o(SmallBnd::o(x.glb,y.glb));
+      mod |= z.lub.a(SmallBnd::o(x.lub,y.lub));
+      mod |= x.lub.a(z.lub);
+      mod |= y.lub.a(z.lub);
+      mod |= x.glb.o(SmallBnd::d(z.glb,y.lub));
+      mod |= y.glb.o(SmallBnd::d(z.glb,x.lub));
+      {
+        long long int i = SmallBnd::a(x.lub,y.lub).size();
+        // |z| = |x| + |y| - |x \cap y|
+        gq(z.cmin, std::max(x.cmin,y.cmin), mod);
+        gq(z.cmin, x.cmin + y.cmin - i, mod);
+        lq(z.cmax, x.cmax + y.cmax, mod);
+        lq(x.cmax, z.cmax, mod);
+        lq(y.cmax, z.cmax, mod);
+        gq(x.cmin, z.cmin - y.cmax, mod);
+        gq(y.cmin, z.cmin - x.cmax, mod);
+      }
+      break;
+    case SOT_MINUS:
+      // z = x \setminus y
+      mod |= z.glb.o(SmallBnd::d(x.glb,y.lub));
+      mod |= z.lub.a(SmallBnd::d(x.lub,y.glb));
+      mod |= x.glb.o(z.glb);
+      mod |= y.lub.d(z.glb);
+      mod |= y.glb.o(SmallBnd::d(x.glb,z.lub));
+      mod |= x.lub.a(SmallBnd::o(z.lub,y.lub));
+      {
+        // |z| = |x| - |x \cap y|
+        long long int i = std::min(static_cast<long long int>
+                                   (SmallBnd::a(x.lub,y.lub).size()),
+                                   y.cmax);
+        long long int g = SmallBnd::a(x.glb,y.glb).size();
+        gq(z.cmin, x.cmin - i, mod);
+        lq(z.cmax, x.cmax - g, mod);
+        gq(x.cmin, z.cmin + g, mod);
+        lq(x.cmax, z.cmax + i, mod);
+      }
+      break;
+    default: GECODE_NEVER;
+    }
+  }
+
+  template<SetOpType op>
+  forceinline
+  SmallTernary<op>::SmallTernary(Home home, SetView x, SetView y, SetView z,
+                                 int b0)
+    : TernaryPropagator<SetView,PC_SET_ANY>(home,x,y,z), b(b0) {}
+
+  template<SetOpType op>
+  forceinline
+  SmallTernary<op>::SmallTernary(Space& home, SmallTernary& p)
+    : TernaryPropagator<SetView,PC_SET_ANY>(home,p), b(p.b) {}
+
+  template<SetOpType op>
+  ExecStatus
+  SmallTernary<op>::post(Home home, SetView x, SetView y, SetView z, int b) {
+    (void) new (home) SmallTernary<op>(home,x,y,z,b);
+    return ES_OK;
+  }
+
+  template<SetOpType op>
+  Actor*
+  SmallTernary<op>::copy(Space& home) {
+    return new (home) SmallTernary<op>(home,*this);
+  }
+
+  template<SetOpType op>
+  ExecStatus
+  SmallTernary<op>::propagate(Space& home, const ModEventDelta&) {
+    // The bounds are only exact for shared views if all are assigned
+    bool assigned = x0.assigned() && x1.assigned() && x2.assigned();
+    SmallView x, y, z;
+    x.init(x0,b); y.init(x1,b); z.init(x2,b);
+
+    bool mod;
+    do {
+      mod = false;
+      round(x,y,z,mod);
+      GECODE_ES_CHECK(x.normalize(mod));
+      GECODE_ES_CHECK(y.normalize(mod));
+      GECODE_ES_CHECK(z.normalize(mod));
+    } while (mod);
+
+    GECODE_ES_CHECK(x.tell(home,x0,b));
+    GECODE_ES_CHECK(y.tell(home,x1,b));
+    GECODE_ES_CHECK(z.tell(home,x2,b));
+
+    if (shared(x0,x1,x2))
+      return assigned ? home.ES_SUBSUMED(*this) : ES_NOFIX;
+    if (x0.assigned() && x1.assigned() && x2.assigned())
+      return home.ES_SUBSUMED(*this);
+    return ES_FIX;
+  }
+
+}}}
+
+// STATISTICS: set-prop
@@ -437,6 +437,47 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test for database of clauses
+     class Clauses : public Test {
+     protected:
+       /// Clauses in DIMACS style (variable indices modulo the arity)
+       Gecode::IntArgs l;
+       /// Number of variables referred to by the clauses
+       int m;
+       /// Test whether literal \a k is true in \a x
+       static bool one(const Assignment& x, int k) {
+         return (k > 0) ? (x[(k-1) % x.size()] == 1)
+                        : (x[(-k-1) % x.size()] == 0);
+       }
+     public:
+       /// Construct and register test
+       Clauses(const std::string& s, int n, int m0, const Gecode::IntArgs& l0)
+         : Test("Bool::Clauses::"+s,n,0,1), l(l0), m(m0) {}
+       /// Check whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         bool sat = false;
+         for (int k=0; k<l.size(); k++)
+           if (l[k] == 0) {
+             if (!sat)
+               return false;
+             sat = false;
+           } else if (one(x,l[k])) {
+             sat = true;
+           }
+         return true;
+       }
+       /// Post constraint
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         BoolVarArgs b(m);
+         for (int i=0; i<x.size(); i++)
+           b[i]=channel(home,x[i]);
+         for (int i=x.size(); i<m; i++)
+           b[i]=b[i % x.size()];
+         clauses(home, b, l);
+       }
+     };
+
      /// %Test for if-then-else-constraint
      class ITEInt : public Test {
      public:
@@ -533,6 +574,17 @@ namespace Test { namespace Int {
      };
 
      Create c;
+     Clauses clauses_chain("Chain",6,6,
+                           {1,2,0, -2,3,0, -3,4,0, -4,-1,5,0,
+                            -5,6,2,0, -6,-1,0});
+     Clauses clauses_simplify("Simplify",4,4,
+                              {1,1,2,0, 1,-1,3,0, -4,0,
+                               2,3,-1,2,0, 3,4,0});
+     Clauses clauses_shared("Shared",4,6,
+                            {1,-5,2,0, -2,6,3,0, 5,3,-4,0,
+                             -6,-3,4,0, -1,-3,0});
+     Clauses clauses_unsat("Unsat",3,3,
+                           {1,2,0, -1,2,0, 1,-2,0, -1,-2,3,0, -3,-2,0});
      ITEInt itebnd(Gecode::IPL_BND);
      ITEInt itedom(Gecode::IPL_DOM);
      ITEBool itebool;
@@ -573,6 +573,26 @@ namespace Test { namespace Int {
             }
           }
         }
+
+        // Time-table edge-finding and energetic reasoning
+        for (IntPropLevel vbd : {IPL_BND, IPL_DOM})
+          for (IntPropBasicAdvanced ipba; ipba(); ++ipba) {
+            IntPropLevel ipl = static_cast<IntPropLevel>(vbd | ipba.ipl());
+            for (int c=-7; c<8; c++) {
+              int off = 0;
+              for (int coff=0; coff<2; coff++) {
+                (void) new ManFixPCumulative(c,p2,u3,off,ipl);
+                (void) new ManFixPCumulative(c,p3,u3,off,ipl);
+                (void) new ManFixPCumulative(c,p4,u4,off,ipl);
+                (void) new ManFlexCumulative(c,0,2,u3,off,ipl);
+                (void) new ManFlexCumulative(c,3,5,u4,off,ipl);
+                (void) new OptFixPCumulative(c,p3,u3,off,ipl);
+                (void) new OptFixPCumulative(c,p4,u4,off,ipl);
+                (void) new OptFlexCumulative(c,3,5,u3,off,ipl);
+                off = Gecode::Int::Limits::min;
+              }
+            }
+          }
       }
     };
 
@@ -270,6 +270,10 @@ namespace Test { namespace Int {
      Distinct<false> bnd_d(-3,3,Gecode::IPL_BND);
      Distinct<false> val_d(-3,3,Gecode::IPL_VAL);
      Distinct<false> dom_s(d,Gecode::IPL_DOM);
+     Distinct<false> dom_a_d(-3,3,Gecode::IntPropLevel(Gecode::IPL_DOM |
+                                                        Gecode::IPL_ADVANCED));
+     Distinct<false> dom_a_s(d,Gecode::IntPropLevel(Gecode::IPL_DOM |
+                                                    Gecode::IPL_ADVANCED));
      Distinct<false> bnd_s(d,Gecode::IPL_BND);
      Distinct<false> val_s(d,Gecode::IPL_VAL);
 
@@ -328,6 +332,8 @@ namespace Test { namespace Int {
      Except ev5(v5,Gecode::IPL_VAL);
 
      Random dom_r(20,-50,50,Gecode::IPL_DOM);
+     Random dom_a_r(20,-50,50,Gecode::IntPropLevel(Gecode::IPL_DOM |
+                                                  Gecode::IPL_ADVANCED));
      Random bnd_r(50,-500,500,Gecode::IPL_BND);
      Random val_r(50,-500,500,Gecode::IPL_VAL);
 
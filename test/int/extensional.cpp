@@ -458,10 +458,11 @@ namespace Test { namespace Int {
        virtual bool solution(const Assignment& x) const {
          using namespace Gecode;
          for (int i=ts.tuples(); i--; ) {
-           TupleSet::Tuple t = ts[i];
+           TupleSet::Tuple l = ts[i];
+           TupleSet::Tuple u = ts.upper(i);
            bool same = true;
            for (int j=0; (j < ts.arity()) && same; j++)
-             if (t[j] != x[j])
+             if ((x[j] < l[j]) || (x[j] > u[j]))
                same = false;
            if (same)
              return pos;
@@ -485,6 +486,47 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test with MDD
+     class MDDTest : public Test {
+     protected:
+       /// The tuple set to use
+       Gecode::TupleSet ts;
+       /// Whether to validate MDD construction from a DFA
+       bool toDFA;
+     public:
+       /// Create and register test
+       MDDTest(const std::string& s,
+               Gecode::IntSet d0, Gecode::TupleSet ts0, bool td)
+         : Test("Extensional::MDD::" + s,
+                ts0.arity(),d0,false,Gecode::IPL_DOM),
+           ts(ts0), toDFA(td) {
+       }
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         using namespace Gecode;
+         for (int i=ts.tuples(); i--; ) {
+           TupleSet::Tuple t = ts[i];
+           bool same = true;
+           for (int j=0; (j < ts.arity()) && same; j++)
+             if (t[j] != x[j])
+               same = false;
+           if (same)
+             return true;
+         }
+         return false;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         MDD m(ts);
+         if (toDFA) {
+           MDD d(ts.arity(),tupleset2dfa(ts));
+           assert(m == d);
+         }
+         extensional(home, x, m, ipl);
+       }
+     };
+
      class RandomTupleSetTest : public TupleSetTest {
      public:
        /// Create and register test
@@ -726,6 +768,44 @@ namespace Test { namespace Int {
                                      IntSet(IntArgs({m,m+1,m+4,M-3,M-2,M})),
                                      ts,true);
            }
+           {
+             int m = Gecode::Int::Limits::min;
+             int M = Gecode::Int::Limits::max;
+             TupleSet ts(4);
+             ts.add({1,m,0,2},{1,M,3,2})
+               .add({0,2,m,0},{2,2,M,0})
+               .add({3,1,1,1})
+               .add({0,0,2,m},{1,3,2,4})
+               .add({2,1,3,0},{1,4,4,4})
+               .finalize();
+             (void) new TupleSetTest("Compressed",pos,IntSet(0,4),ts,false);
+           }
+           {
+             int m = Gecode::Int::Limits::min;
+             int M = Gecode::Int::Limits::max;
+             TupleSet ts(3);
+             ts.add({m,m+1,0},{M,m+1,0})
+               .add({M,m,m},{M,M,1})
+               .add({0,0,M},{0,0,M})
+               .finalize();
+             (void) new TupleSetTest("CompressedMinMax",pos,
+                                     IntSet(IntArgs({m,m+1,0,1,M-1,M})),
+                                     ts,false);
+           }
+           {
+             TupleSet ts(5);
+             for (int i = 0; i < 40; i++) {
+               IntArgs l(5), u(5);
+               for (int j = 0; j < 5; j++) {
+                 l[j] = rand(7) - 1;
+                 u[j] = (rand(3) == 0) ? l[j] + rand(3) : l[j];
+               }
+               ts.add(l,u);
+             }
+             ts.finalize();
+             (void) new TupleSetTest("CompressedRand",pos,IntSet(-1,5),ts,
+                                     false);
+           }
            {
              TupleSet ts(7);
              for (int i = 0; i < 10000; i++) {
@@ -796,6 +876,53 @@ namespace Test { namespace Int {
            (void) new TupleSetLarge(0.05,pos);
            (void) new TupleSetBool(0.3,pos);
          }
+         {
+           TupleSet ts(4);
+           ts.add({2, 1, 2, 4}).add({2, 2, 1, 4})
+             .add({4, 3, 4, 1}).add({1, 3, 2, 3})
+             .add({3, 3, 3, 2}).add({5, 1, 4, 4})
+             .add({2, 5, 1, 5}).add({4, 3, 5, 1})
+             .add({1, 5, 2, 5}).add({5, 3, 3, 2})
+             .finalize();
+           (void) new MDDTest("A",IntSet(0,6),ts,true);
+         }
+         {
+           TupleSet ts(4);
+           ts.finalize();
+           (void) new MDDTest("Empty",IntSet(1,2),ts,true);
+         }
+         {
+           TupleSet ts(1);
+           ts.add({1}).add({2}).add({3}).finalize();
+           (void) new MDDTest("Single",IntSet(-4,4),ts,true);
+         }
+         {
+           int m = Gecode::Int::Limits::min;
+           int M = Gecode::Int::Limits::max;
+           TupleSet ts(3);
+           ts.add({M-0,m+1,M-2}).add({m+4,M-1,M-3})
+             .add({m+2,M-3,m+0}).add({M-2,M-3,M-0})
+             .finalize();
+           (void) new MDDTest("MinMax",
+                              IntSet(IntArgs({m,m+1,m+4,M-3,M-2,M})),
+                              ts,true);
+         }
+         {
+           // Shared suffixes and prefixes make nodes mergeable
+           TupleSet ts(5);
+           CpltAssignment ass(3, IntSet(0, 2));
+           while (ass.has_more()) {
+             if ((ass[0] + ass[1] + ass[2]) % 2 == 0) {
+               ts.add({ass[0],ass[1],1,ass[2],ass[1]});
+               ts.add({ass[0],ass[1],3,ass[2],ass[1]});
+             }
+             ass.next(rand);
+           }
+           ts.finalize();
+           (void) new MDDTest("Parity",IntSet(0,3),ts,true);
+         }
+         (void) new MDDTest("Rand(5,-2,2)",IntSet(-2,2),
+                            randomTupleSet(5, -2, 2, 0.1, rand),false);
        }
      };
 
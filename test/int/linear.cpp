@@ -98,6 +98,22 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test linear relation over many integer variables
+     class IntIntLarge : public IntInt {
+     public:
+       /// Create and register test
+       IntIntLarge(const std::string& s, const Gecode::IntSet& d,
+                   const Gecode::IntArgs& a0, Gecode::IntRelType irt0,
+                   int c0, Gecode::IntPropLevel ipl)
+         : IntInt(s,d,a0,irt0,c0,ipl) {
+         testsearch = false;
+       }
+       /// Create random assignment
+       virtual Assignment* assignment(void) const {
+         return new RandomAssignment(arity,dom,500,_rand);
+       }
+     };
+
      /// %Test linear relation over integer variables
      class IntVar : public Test {
      protected:
@@ -285,6 +301,8 @@ namespace Test { namespace Int {
            (void) new IntInt("21",d2,a1,IRT_EQ,0,IPL_DOM);
            (void) new IntVar("21",d2,a1,IRT_EQ,IPL_DOM);
 
+           const IntPropLevel ipl_a = IntPropLevel(IPL_BND | IPL_ADVANCED);
+
            const int av2[5] = {1,1,1,1,1};
            const int av3[5] = {1,-1,-1,1,-1};
            const int av4[5] = {2,3,5,7,11};
@@ -306,6 +324,14 @@ namespace Test { namespace Int {
                (void) new IntInt("24",d2,a4,irts.irt(),0);
                (void) new IntInt("25",d2,a5,irts.irt(),0);
                (void) new IntInt("32",d3,a2,irts.irt(),1500000000);
+               if (i >= 4) {
+                 // Incremental propagators
+                 (void) new IntInt("12",d1,a2,irts.irt(),0,ipl_a);
+                 (void) new IntInt("13",d1,a3,irts.irt(),0,ipl_a);
+                 (void) new IntInt("14",d1,a4,irts.irt(),0,ipl_a);
+                 (void) new IntInt("15",d1,a5,irts.irt(),0,ipl_a);
+                 (void) new IntInt("32",d3,a2,irts.irt(),1500000000,ipl_a);
+               }
                if (i < 5) {
                  (void) new IntVar("12",d1,a2,irts.irt());
                  (void) new IntVar("13",d1,a3,irts.irt());
@@ -333,6 +359,21 @@ namespace Test { namespace Int {
              }
            }
          }
+         {
+           // Incremental propagators with many views
+           const IntPropLevel ipl_a = IntPropLevel(IPL_BND | IPL_ADVANCED);
+           IntSet d(-2,2);
+           IntArgs a1(40), a2(40);
+           for (int i=0; i<40; i++) {
+             a1[i] = 1;
+             a2[i] = ((i % 2) == 0) ? 1 + (i % 7) : -1 - (i % 5);
+           }
+           for (IntRelTypes irts; irts(); ++irts)
+             for (int c=0; c<=8; c += 4) {
+               (void) new IntIntLarge("41",d,a1,irts.irt(),c,ipl_a);
+               (void) new IntIntLarge("42",d,a2,irts.irt(),c,ipl_a);
+             }
+         }
          {
            const int av1[10] = {
              1, 1, 1, 1, 1, 1, 1, 1, 1, 1